@@ -27,7 +27,26 @@ void ULPPChunkRequester::BeginPlay ( )
 {
 	Super::BeginPlay ( );
 
-	// ...
+	if ( bUseAggregatedStreaming && IsValid ( GetWorld ( ) ) )
+	{
+		if ( ULPPChunkManagerSubsystem* ManagerSystem = GetWorld ( )->GetSubsystem < ULPPChunkManagerSubsystem > ( ) ; IsValid ( ManagerSystem ) )
+		{
+			ManagerSystem->RegisterStreamingSource ( GetOwner ( ) , NearbyLoadDistance , MaxLoadDistance );
+		}
+	}
+}
+
+void ULPPChunkRequester::EndPlay ( const EEndPlayReason::Type EndPlayReason )
+{
+	if ( bUseAggregatedStreaming && IsValid ( GetWorld ( ) ) )
+	{
+		if ( ULPPChunkManagerSubsystem* ManagerSystem = GetWorld ( )->GetSubsystem < ULPPChunkManagerSubsystem > ( ) ; IsValid ( ManagerSystem ) )
+		{
+			ManagerSystem->UnregisterStreamingSource ( GetOwner ( ) );
+		}
+	}
+
+	Super::EndPlay ( EndPlayReason );
 }
 
 
@@ -50,6 +69,21 @@ void ULPPChunkRequester::ChangeLoadChunkIndex ( const int32 ComponentIndex , con
 
 	CurrentCenterChunkIndex = NewCenterChunkIndex;
 
+	if ( bUseAggregatedStreaming )
+	{
+		if ( IsValid ( GetWorld ( ) ) == false )
+		{
+			return;
+		}
+
+		if ( ULPPChunkManagerSubsystem* ManagerSystem = GetWorld ( )->GetSubsystem < ULPPChunkManagerSubsystem > ( ) ; IsValid ( ManagerSystem ) )
+		{
+			ManagerSystem->UpdateStreamingSource ( GetOwner ( ) , ComponentIndex , RegionIndex , ChunkIndex );
+		}
+
+		return;
+	}
+
 	UnloadOutBoundChunk ( );
 	LoadChunkByNearbyPoint ( );
 }
@@ -81,6 +115,12 @@ void ULPPChunkRequester::LoadChunkByNearbyPoint ( )
 		return;
 	}
 
+	const int32 LoadWidth = NearbyLoadDistance * 2 + 1;
+
+	TArray < FIntVector > LoadList;
+
+	LoadList.Reserve ( LoadWidth * LoadWidth * LoadWidth );
+
 	for ( int32 Index_X = -NearbyLoadDistance ; Index_X <= NearbyLoadDistance ; ++Index_X )
 	{
 		for ( int32 Index_Y = -NearbyLoadDistance ; Index_Y <= NearbyLoadDistance ; ++Index_Y )
@@ -93,13 +133,15 @@ void ULPPChunkRequester::LoadChunkByNearbyPoint ( )
 
 				if ( LoadedChunkMap.Contains ( LoadChunkIndex ) == false && DataComponent->IsChunkIndexValid ( ChunkGridIndex.X , ChunkGridIndex.Y ) )
 				{
-					LoadedChunkMap.Add ( LoadOffset );
+					LoadedChunkMap.Add ( LoadChunkIndex );
 
-					ManagerSystem->LoadChunk ( LoadChunkIndex.X , LoadChunkIndex.Y , LoadChunkIndex.Z , GetOwner ( ) );
+					LoadList.Add ( LoadChunkIndex );
 				}
 			}
 		}
 	}
+
+	ManagerSystem->LoadChunkList ( LoadList , GetOwner ( ) );
 }
 
 void ULPPChunkRequester::UnloadOutBoundChunk ( )
@@ -156,7 +198,7 @@ void ULPPChunkRequester::UnloadOutBoundChunk ( )
 	for ( const FIntVector& RemoveIndex : RemoveList )
 	{
 		LoadedChunkMap.Remove ( RemoveIndex );
-
-		ManagerSystem->UnloadChunk ( RemoveIndex.X , RemoveIndex.Y , RemoveIndex.Z , GetOwner ( ) );
 	}
+
+	ManagerSystem->UnloadChunkList ( RemoveList , GetOwner ( ) );
 }
@@ -223,7 +223,11 @@ void FLPPChunkedDynamicMeshProxy::InitializeFromData ( )
 		return;
 	}
 
-	if ( MeshRenderData->MeshData->TriangleCount ( ) != 0 )
+	if ( MeshRenderData->HasStreamData ( ) )
+	{
+		InitializeFromStream ( *MeshRenderData->StreamData );
+	}
+	else if ( MeshRenderData->MeshData->TriangleCount ( ) != 0 )
 	{
 		/** Vertex position */
 		TArray < FVector3f > MeshPosition = TArray < FVector3f > ( );
@@ -370,6 +374,108 @@ void FLPPChunkedDynamicMeshProxy::InitializeFromData ( )
 	UpdatedReferencedMaterials ( );
 }
 
+void FLPPChunkedDynamicMeshProxy::InitializeFromStream ( const FLPPDynamicMeshStreamData& StreamData )
+{
+	ensure ( AllocatedBufferSets.IsEmpty ( ) );
+
+	if ( StreamData.IsEmpty ( ) )
+	{
+		return;
+	}
+
+	uint8 TotalMaterialCount = 0;
+
+	for ( const uint8 MaterialID : StreamData.MaterialList )
+	{
+		TotalMaterialCount = FMath::Max ( TotalMaterialCount , MaterialID );
+	}
+
+	TArray < FMeshRenderBufferSet* > RenderBufferSetList;
+
+	TArray < FVector3f > SectionPositionList;
+	TArray < uint32 >    SectionIndexList;
+	TArray < int32 >     SectionVertexMap;
+
+	for ( int32 SectionIndex = 0 ; SectionIndex <= TotalMaterialCount ; ++SectionIndex )
+	{
+		SectionPositionList.Reset ( );
+		SectionIndexList.Reset ( );
+
+		// Stream index to section index
+		SectionVertexMap.Init ( INDEX_NONE , StreamData.PositionList.Num ( ) );
+
+		for ( int32 TriangleIndex = 0 ; TriangleIndex < StreamData.TriangleCount ( ) ; ++TriangleIndex )
+		{
+			const uint8 MaterialID = StreamData.MaterialList.IsValidIndex ( TriangleIndex ) ? StreamData.MaterialList [ TriangleIndex ] : 0;
+
+			if ( MaterialID != SectionIndex )
+			{
+				continue;
+			}
+
+			for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+			{
+				const uint32 StreamIndex = StreamData.IndexList [ TriangleIndex * 3 + Corner ];
+
+				if ( SectionVertexMap [ StreamIndex ] == INDEX_NONE )
+				{
+					SectionVertexMap [ StreamIndex ] = SectionPositionList.Add ( StreamData.PositionList [ StreamIndex ] );
+				}
+
+				SectionIndexList.Add ( SectionVertexMap [ StreamIndex ] );
+			}
+		}
+
+		if ( SectionIndexList.IsEmpty ( ) )
+		{
+			continue;
+		}
+
+		FMeshRenderBufferSet* RenderBufferSet = RenderBufferSetList.Add_GetRef ( AllocateNewRenderBufferSet ( ) );
+		RenderBufferSet->Material             = ParentComponent->GetMaterial ( SectionIndex );
+
+		if ( RenderBufferSet->Material == nullptr )
+		{
+			RenderBufferSet->Material = UMaterial::GetDefaultMaterial ( MD_Surface );
+		}
+
+		RenderBufferSet->TriangleCount = SectionIndexList.Num ( ) / 3;
+		RenderBufferSet->PositionVertexBuffer.Init ( SectionPositionList , false );
+		RenderBufferSet->IndexBuffer.Indices = SectionIndexList;
+
+		RenderBufferSet->StaticMeshVertexBuffer.Init ( SectionPositionList.Num ( ) , 1 , false );
+
+		for ( int32 StreamIndex = 0 ; StreamIndex < SectionVertexMap.Num ( ) ; ++StreamIndex )
+		{
+			const int32 VertexIndex = SectionVertexMap [ StreamIndex ];
+
+			if ( VertexIndex == INDEX_NONE )
+			{
+				continue;
+			}
+
+			const FVector3f Normal = StreamData.NormalList.IsValidIndex ( StreamIndex ) ? StreamData.NormalList [ StreamIndex ] : FVector3f::UpVector;
+
+			FVector3f Tangent;
+			FVector3f BiTangent;
+
+			UE::Geometry::VectorUtil::MakePerpVectors ( Normal , Tangent , BiTangent );
+
+			RenderBufferSet->StaticMeshVertexBuffer.SetVertexUV ( VertexIndex , 0 , StreamData.UVList.IsValidIndex ( StreamIndex ) ? StreamData.UVList [ StreamIndex ] : FVector2f::ZeroVector );
+			RenderBufferSet->StaticMeshVertexBuffer.SetVertexTangents ( VertexIndex , Tangent , BiTangent , Normal );
+		}
+	}
+
+	ENQUEUE_RENDER_COMMAND ( FChunbkedDynamicMeshSceneProxyInitializeStream ) (
+	                                                                           [RenderBufferSetList] ( FRHICommandListImmediate& RHICmdList )
+	                                                                           {
+		                                                                           for ( FMeshRenderBufferSet* RenderBufferSet : RenderBufferSetList )
+		                                                                           {
+			                                                                           RenderBufferSet->Upload ( );
+		                                                                           }
+	                                                                           } );
+}
+
 void FLPPChunkedDynamicMeshProxy::GetDistanceFieldAtlasData ( const class FDistanceFieldVolumeData*& OutDistanceFieldData , float& SelfShadowBias ) const
 {
 	if ( DistanceFieldPtr.IsValid ( ) )
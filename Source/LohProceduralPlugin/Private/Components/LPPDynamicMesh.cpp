@@ -73,7 +73,7 @@ void ULPPDynamicMesh::SetMesh ( FLPPDynamicMeshRenderData&& MoveData , FKAggrega
 		ReleaseResourcesFence.Wait ( ); // Flush Render
 	}
 
-	if ( MovedData.MeshData->TriangleCount ( ) == 0 )
+	if ( MovedData.GetTriangleCount ( ) == 0 )
 	{
 		ClearMesh ( false );
 
@@ -93,7 +93,7 @@ void ULPPDynamicMesh::SetMesh ( FLPPDynamicMeshRenderData&& MoveData , FKAggrega
 			MeshRenderData->DistanceFieldPtr = OldDistanceFieldPtr;
 		}
 
-		MeshRenderData->LocalBounds = MeshRenderData->MeshData->GetBounds ( true );
+		MeshRenderData->LocalBounds = MeshRenderData->GetMeshBounds ( );
 
 		AggGeom = MoveTemp ( MovedAgg );
 
@@ -155,7 +155,7 @@ void ULPPDynamicMesh::NotifyMaterialSetUpdated ( )
 
 bool ULPPDynamicMesh::GetTriMeshSizeEstimates ( struct FTriMeshCollisionDataEstimates& OutTriMeshEstimates , bool bInUseAllTriData ) const
 {
-	OutTriMeshEstimates.VerticeCount = MeshRenderData->MeshData->VertexCount ( );
+	OutTriMeshEstimates.VerticeCount = MeshRenderData->HasStreamData ( ) ? MeshRenderData->StreamData->PositionList.Num ( ) : MeshRenderData->MeshData->VertexCount ( );
 	return true;
 }
 
@@ -166,6 +166,59 @@ bool ULPPDynamicMesh::GetPhysicsTriMeshData ( struct FTriMeshCollisionData* Coll
 		return false;
 	}
 
+	// Stream is already indexed per vertex, so it can be copy without building a dynamic mesh
+	if ( MeshRenderData->HasStreamData ( ) )
+	{
+		const FLPPDynamicMeshStreamData& StreamData = *MeshRenderData->StreamData;
+
+		CollisionData->Vertices = StreamData.PositionList;
+
+		if ( UPhysicsSettings::Get ( )->bSupportUVFromHitResults )
+		{
+			CollisionData->UVs.SetNum ( 1 );
+			CollisionData->UVs [ 0 ].Reserve ( StreamData.UVList.Num ( ) );
+
+			for ( const FVector2f& UV : StreamData.UVList )
+			{
+				CollisionData->UVs [ 0 ].Add ( FVector2D ( UV ) );
+			}
+		}
+
+		CollisionData->Indices.Reserve ( StreamData.TriangleCount ( ) );
+		CollisionData->MaterialIndices.Reserve ( StreamData.TriangleCount ( ) );
+
+		for ( int32 TriangleIndex = 0 ; TriangleIndex < StreamData.TriangleCount ( ) ; ++TriangleIndex )
+		{
+			FTriIndices Triangle;
+			Triangle.v0 = StreamData.IndexList [ TriangleIndex * 3 ];
+			Triangle.v1 = StreamData.IndexList [ TriangleIndex * 3 + 1 ];
+			Triangle.v2 = StreamData.IndexList [ TriangleIndex * 3 + 2 ];
+
+			// Same degenerate filter as below
+			const FVector3f& A = CollisionData->Vertices [ Triangle.v0 ];
+			const FVector3f& B = CollisionData->Vertices [ Triangle.v1 ];
+			const FVector3f& C = CollisionData->Vertices [ Triangle.v2 ];
+			if ( A == B || A == C || B == C )
+			{
+				continue;
+			}
+			const float SquaredArea = FVector3f::CrossProduct ( A - B , A - C ).SizeSquared ( );
+			if ( SquaredArea < UE_SMALL_NUMBER )
+			{
+				continue;
+			}
+
+			CollisionData->Indices.Add ( Triangle );
+			CollisionData->MaterialIndices.Add ( StreamData.MaterialList.IsValidIndex ( TriangleIndex ) ? StreamData.MaterialList [ TriangleIndex ] : 0 );
+		}
+
+		CollisionData->bFlipNormals    = true;
+		CollisionData->bDeformableMesh = true;
+		CollisionData->bFastCook       = true;
+
+		return true;
+	}
+
 	// See if we should copy UVs
 	const bool bCopyUVs = UPhysicsSettings::Get ( )->bSupportUVFromHitResults && MeshRenderData->MeshData->HasAttributes ( ) && MeshRenderData->MeshData->Attributes ( )->NumUVLayers ( ) > 0;
 
@@ -4,10 +4,127 @@
 #include "Data/LPPDynamicMeshRenderData.h"
 
 #include "DistanceFieldAtlas.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
 #include "MeshCardBuild.h"
 #include "Rendering/NaniteResources.h"
 
 
+void FLPPDynamicMeshStreamData::Reset ( )
+{
+	PositionList.Reset ( );
+	NormalList.Reset ( );
+	UVList.Reset ( );
+	IndexList.Reset ( );
+	MaterialList.Reset ( );
+}
+
+SIZE_T FLPPDynamicMeshStreamData::GetByteCount ( ) const
+{
+	return PositionList.GetAllocatedSize ( ) + NormalList.GetAllocatedSize ( ) + UVList.GetAllocatedSize ( ) + IndexList.GetAllocatedSize ( ) + MaterialList.GetAllocatedSize ( );
+}
+
+UE::Geometry::FAxisAlignedBox3d FLPPDynamicMeshStreamData::GetBounds ( ) const
+{
+	UE::Geometry::FAxisAlignedBox3d Bounds = UE::Geometry::FAxisAlignedBox3d::Empty ( );
+
+	for ( const FVector3f& Position : PositionList )
+	{
+		Bounds.Contain ( FVector3d ( Position ) );
+	}
+
+	return Bounds;
+}
+
+void FLPPDynamicMeshStreamData::ToDynamicMesh ( UE::Geometry::FDynamicMesh3& OutMesh ) const
+{
+	OutMesh.Clear ( );
+	OutMesh.EnableAttributes ( );
+	OutMesh.Attributes ( )->EnableMaterialID ( );
+
+	UE::Geometry::FDynamicMeshNormalOverlay*     NormalOverlay     = OutMesh.Attributes ( )->PrimaryNormals ( );
+	UE::Geometry::FDynamicMeshUVOverlay*         UVOverlay         = OutMesh.Attributes ( )->PrimaryUV ( );
+	UE::Geometry::FDynamicMeshMaterialAttribute* MaterialAttribute = OutMesh.Attributes ( )->GetMaterialID ( );
+
+	TMap < FVector3f , int32 > PositionMap;
+
+	TArray < int32 > VertexIDList;
+	TArray < int32 > NormalIDList;
+	TArray < int32 > UVIDList;
+
+	PositionMap.Reserve ( PositionList.Num ( ) );
+	VertexIDList.SetNumUninitialized ( PositionList.Num ( ) );
+	NormalIDList.SetNumUninitialized ( PositionList.Num ( ) );
+	UVIDList.SetNumUninitialized ( PositionList.Num ( ) );
+
+	for ( int32 VertexIndex = 0 ; VertexIndex < PositionList.Num ( ) ; ++VertexIndex )
+	{
+		if ( const int32* VertexIDPtr = PositionMap.Find ( PositionList [ VertexIndex ] ) ; VertexIDPtr != nullptr )
+		{
+			VertexIDList [ VertexIndex ] = *VertexIDPtr;
+		}
+		else
+		{
+			VertexIDList [ VertexIndex ] = OutMesh.AppendVertex ( FVector3d ( PositionList [ VertexIndex ] ) );
+
+			PositionMap.Add ( PositionList [ VertexIndex ] , VertexIDList [ VertexIndex ] );
+		}
+
+		NormalIDList [ VertexIndex ] = NormalOverlay->AppendElement ( NormalList.IsValidIndex ( VertexIndex ) ? NormalList [ VertexIndex ] : FVector3f::UpVector );
+		UVIDList [ VertexIndex ]     = UVOverlay->AppendElement ( UVList.IsValidIndex ( VertexIndex ) ? UVList [ VertexIndex ] : FVector2f::ZeroVector );
+	}
+
+	for ( int32 TriangleIndex = 0 ; TriangleIndex < TriangleCount ( ) ; ++TriangleIndex )
+	{
+		const UE::Geometry::FIndex3i StreamTriangle ( IndexList [ TriangleIndex * 3 ] , IndexList [ TriangleIndex * 3 + 1 ] , IndexList [ TriangleIndex * 3 + 2 ] );
+
+		int32 TriangleID = OutMesh.AppendTriangle ( VertexIDList [ StreamTriangle.A ] , VertexIDList [ StreamTriangle.B ] , VertexIDList [ StreamTriangle.C ] );
+
+		// Non-manifold edge, give this triangle its own vertex
+		if ( TriangleID == UE::Geometry::FDynamicMesh3::NonManifoldID )
+		{
+			TriangleID = OutMesh.AppendTriangle (
+			                                     OutMesh.AppendVertex ( FVector3d ( PositionList [ StreamTriangle.A ] ) ) ,
+			                                     OutMesh.AppendVertex ( FVector3d ( PositionList [ StreamTriangle.B ] ) ) ,
+			                                     OutMesh.AppendVertex ( FVector3d ( PositionList [ StreamTriangle.C ] ) )
+			                                    );
+		}
+
+		if ( TriangleID < 0 )
+		{
+			continue;
+		}
+
+		NormalOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( NormalIDList [ StreamTriangle.A ] , NormalIDList [ StreamTriangle.B ] , NormalIDList [ StreamTriangle.C ] ) );
+		UVOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( UVIDList [ StreamTriangle.A ] , UVIDList [ StreamTriangle.B ] , UVIDList [ StreamTriangle.C ] ) );
+		MaterialAttribute->SetValue ( TriangleID , MaterialList.IsValidIndex ( TriangleIndex ) ? MaterialList [ TriangleIndex ] : 0 );
+	}
+}
+
+void FLPPDynamicMeshStreamData::AppendGeometryToDynamicMesh ( UE::Geometry::FDynamicMesh3& OutMesh ) const
+{
+	const int32 VertexOffset = OutMesh.MaxVertexID ( );
+
+	for ( const FVector3f& Position : PositionList )
+	{
+		OutMesh.AppendVertex ( FVector3d ( Position ) );
+	}
+
+	for ( int32 TriangleIndex = 0 ; TriangleIndex < TriangleCount ( ) ; ++TriangleIndex )
+	{
+		const UE::Geometry::FIndex3i StreamTriangle ( IndexList [ TriangleIndex * 3 ] , IndexList [ TriangleIndex * 3 + 1 ] , IndexList [ TriangleIndex * 3 + 2 ] );
+
+		// Non-manifold edge, give this triangle its own vertex
+		if ( OutMesh.AppendTriangle ( StreamTriangle.A + VertexOffset , StreamTriangle.B + VertexOffset , StreamTriangle.C + VertexOffset ) == UE::Geometry::FDynamicMesh3::NonManifoldID )
+		{
+			OutMesh.AppendTriangle (
+			                        OutMesh.AppendVertex ( FVector3d ( PositionList [ StreamTriangle.A ] ) ) ,
+			                        OutMesh.AppendVertex ( FVector3d ( PositionList [ StreamTriangle.B ] ) ) ,
+			                        OutMesh.AppendVertex ( FVector3d ( PositionList [ StreamTriangle.C ] ) )
+			                       );
+		}
+	}
+}
+
 FLPPDynamicMeshRenderData::FLPPDynamicMeshRenderData ( ) : bHasNaniteFallbackMesh ( false )
                                                            , bReadyForStreaming ( false )
 {
@@ -28,6 +145,43 @@ FLPPDynamicMeshRenderData::~FLPPDynamicMeshRenderData ( )
 	//}
 }
 
+int32 FLPPDynamicMeshRenderData::GetTriangleCount ( ) const
+{
+	if ( HasStreamData ( ) )
+	{
+		return StreamData->TriangleCount ( );
+	}
+
+	return MeshData.IsValid ( ) ? MeshData->TriangleCount ( ) : 0;
+}
+
+UE::Geometry::FAxisAlignedBox3d FLPPDynamicMeshRenderData::GetMeshBounds ( ) const
+{
+	if ( HasStreamData ( ) )
+	{
+		return StreamData->GetBounds ( );
+	}
+
+	return MeshData.IsValid ( ) ? MeshData->GetBounds ( true ) : UE::Geometry::FAxisAlignedBox3d::Empty ( );
+}
+
+const UE::Geometry::FDynamicMesh3& FLPPDynamicMeshRenderData::GetDynamicMesh ( )
+{
+	FScopeLock Lock ( &MeshDataLock );
+
+	if ( MeshData.IsValid ( ) == false )
+	{
+		MeshData = MakePimpl < UE::Geometry::FDynamicMesh3 > ( );
+	}
+
+	if ( HasStreamData ( ) && MeshData->TriangleCount ( ) == 0 )
+	{
+		StreamData->ToDynamicMesh ( *MeshData );
+	}
+
+	return *MeshData;
+}
+
 void FLPPDynamicMeshRenderData::InitResources ( ERHIFeatureLevel::Type InFeatureLevel , UMeshComponent* Owner )
 {
 	checkf ( FApp::CanEverRender() || !FPlatformProperties::RequiresCookedData() , TEXT("RenderData should not initialize resources in headless cooked runs") );
@@ -113,6 +267,11 @@ void FLPPDynamicMeshRenderData::GetResourceSizeEx ( FResourceSizeEx& CumulativeR
 		CumulativeResourceSize.AddUnknownMemoryBytes ( TEXT ( "MeshData" ) , MeshData->GetByteCount ( ) );
 	}
 
+	if ( StreamData.IsValid ( ) )
+	{
+		CumulativeResourceSize.AddUnknownMemoryBytes ( TEXT ( "StreamData" ) , StreamData->GetByteCount ( ) );
+	}
+
 	GetNaniteResourcesSizeEx ( NaniteResourcesPtr , CumulativeResourceSize );
 
 	if ( LumenCardData.IsValid ( ) )
@@ -128,12 +287,19 @@ void FLPPDynamicMeshRenderData::GetResourceSizeEx ( FResourceSizeEx& CumulativeR
 
 SIZE_T FLPPDynamicMeshRenderData::GetCPUAccessMemoryOverhead ( ) const
 {
+	SIZE_T OverheadSize = 0;
+
 	if ( MeshData.IsValid ( ) )
 	{
-		return MeshData->GetByteCount ( );
+		OverheadSize += MeshData->GetByteCount ( );
+	}
+
+	if ( StreamData.IsValid ( ) )
+	{
+		OverheadSize += StreamData->GetByteCount ( );
 	}
 
-	return 0;
+	return OverheadSize;
 }
 
 void FLPPDynamicMeshRenderData::ReleaseResources ( )
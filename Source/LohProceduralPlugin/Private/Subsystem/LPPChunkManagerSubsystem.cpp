@@ -7,10 +7,47 @@
 #include "Subsystem/LPPChunkManagerSubsystem.h"
 
 #include "Components/LFPChunkedGridPositionComponent.h"
+#include "Components/LFPChunkedTagDataComponent.h"
 #include "GameFramework/GameStateBase.h"
+#include "GameFramework/WorldSettings.h"
 #include "Interface/LPPChunkActorInterface.h"
 #include "Math/LFPGridLibrary.h"
 
+namespace LPPChunkStreamingHelper
+{
+	/* Empty exclude box, every offset is visit */
+	const FIntVector NoExcludeMin = FIntVector ( 1 , 1 , 1 );
+	const FIntVector NoExcludeMax = FIntVector ( 0 , 0 , 0 );
+
+	/* Call Func on every offset inside the cube that is outside the exclude box */
+	template < typename FuncType >
+	void ForEachOffsetOutsideBox ( const int32 Radius , const FIntVector& ExcludeMin , const FIntVector& ExcludeMax , FuncType&& Func )
+	{
+		for ( int32 Index_X = -Radius ; Index_X <= Radius ; ++Index_X )
+		{
+			const bool bInsideX = Index_X >= ExcludeMin.X && Index_X <= ExcludeMax.X;
+
+			for ( int32 Index_Y = -Radius ; Index_Y <= Radius ; ++Index_Y )
+			{
+				const bool bInsideXY = bInsideX && Index_Y >= ExcludeMin.Y && Index_Y <= ExcludeMax.Y;
+
+				for ( int32 Index_Z = -Radius ; Index_Z <= Radius ; ++Index_Z )
+				{
+					// Jump over the exclude box so only the slab around it is visit
+					if ( bInsideXY && Index_Z >= ExcludeMin.Z && Index_Z <= ExcludeMax.Z )
+					{
+						Index_Z = ExcludeMax.Z;
+
+						continue;
+					}
+
+					Func ( FIntVector ( Index_X , Index_Y , Index_Z ) );
+				}
+			}
+		}
+	}
+}
+
 void ULPPChunkManagerSubsystem::Initialize ( FSubsystemCollectionBase& Collection )
 {
 	Super::Initialize ( Collection );
@@ -21,12 +58,32 @@ void ULPPChunkManagerSubsystem::Tick ( float DeltaTime )
 	const float     CurrentBudget = TickBudget - DeltaTime;
 	const FDateTime StartWorkTime = FDateTime::UtcNow ( );
 
+	ApplyStreamingSourceChange ( );
+
+	if ( LODDistanceList.IsEmpty ( ) == false )
+	{
+		UpdateStreamingSourceLocationCache ( );
+	}
+
 	if ( AsyncLoadChunk.IsEmpty ( ) == false )
 	{
 		do
 		{
 			const FIntVector ChunkIndex = AsyncLoadChunk.Pop ( EAllowShrinking::No );
 
+			if ( FLPPLoadedChunkData* LoadedChunkPtr = LoadedChunkMap.Find ( ChunkIndex ) ; LoadedChunkPtr != nullptr )
+			{
+				LoadedChunkPtr->bIsPendingLoad = false;
+
+				// Send LOD before chunk ID so the first build already use the correct LOD
+				if ( LODDistanceList.IsEmpty ( ) == false )
+				{
+					LoadedChunkPtr->LODIndex = ComputeChunkLOD ( ChunkIndex , *LoadedChunkPtr );
+
+					NotifyChunkLODChanged ( ChunkIndex , LoadedChunkPtr->LODIndex );
+				}
+			}
+
 			NotifyChunkLoad ( ChunkIndex.X , ChunkIndex.Y , ChunkIndex.Z );
 		}
 		while ( AsyncLoadChunk.IsEmpty ( ) == false && CurrentBudget > ( FDateTime::UtcNow ( ) - StartWorkTime ).GetTotalSeconds ( ) );
@@ -52,6 +109,40 @@ void ULPPChunkManagerSubsystem::Tick ( float DeltaTime )
 	{
 		BatchUpdateList.Remove ( RemoveKey );
 	}
+
+	if ( LODDistanceList.IsEmpty ( ) == false )
+	{
+		LODUpdateTimer -= DeltaTime;
+
+		if ( LODUpdateTimer <= 0.0f )
+		{
+			LODUpdateTimer = LODUpdateInterval;
+
+			UpdateChunkLOD ( );
+		}
+
+		RemoveList.Reset ( );
+
+		for ( const FIntVector& ChunkID : PendingLODChunkList )
+		{
+			if ( const FLPPLoadedChunkData* LoadedChunkPtr = LoadedChunkMap.Find ( ChunkID ) ; LoadedChunkPtr != nullptr )
+			{
+				NotifyChunkLODChanged ( ChunkID , LoadedChunkPtr->LODIndex );
+			}
+
+			RemoveList.Add ( ChunkID );
+
+			if ( CurrentBudget <= ( FDateTime::UtcNow ( ) - StartWorkTime ).GetTotalSeconds ( ) )
+			{
+				break;
+			}
+		}
+
+		for ( const FIntVector& RemoveKey : RemoveList )
+		{
+			PendingLODChunkList.Remove ( RemoveKey );
+		}
+	}
 }
 
 TStatId ULPPChunkManagerSubsystem::GetStatId ( ) const
@@ -100,6 +191,23 @@ void ULPPChunkManagerSubsystem::SetupChunkManager (
 		LoadedChunkMap.Reset ( );
 	}
 
+	ChunkOccupancyMap.Reset ( );
+
+	{
+		// Loaded chunk is gone, so every source need to rebuild its bucket
+		StreamingBucketMap.Reset ( );
+		ChunkInterestCountMap.Reset ( );
+		PendingStreamLoadList.Reset ( );
+		PendingStreamUnloadList.Reset ( );
+
+		for ( auto& StreamingSource : StreamingSourceMap )
+		{
+			StreamingSource.Value.CenterChunkID = FIntVector::NoneValue;
+
+			DirtyStreamingSourceList.Add ( StreamingSource.Key );
+		}
+	}
+
 	{
 		ComponentChunkGapList.Reset ( );
 
@@ -123,6 +231,55 @@ void ULPPChunkManagerSubsystem::SetupChunkManager (
 	}
 }
 
+void ULPPChunkManagerSubsystem::SetupChunkLOD ( const TArray < float >& NewLODDistanceList , const float NewLODHysteresis , const float NewLODUpdateInterval )
+{
+	LODDistanceList = NewLODDistanceList;
+
+	LODDistanceList.Sort ( );
+
+	LODHysteresis     = FMath::Max ( NewLODHysteresis , 0.0f );
+	LODUpdateInterval = FMath::Max ( NewLODUpdateInterval , 0.0f );
+	LODUpdateTimer    = 0.0f;
+
+	PendingLODChunkList.Reset ( );
+
+	if ( LODDistanceList.IsEmpty ( ) )
+	{
+		for ( auto& LoadedChunk : LoadedChunkMap )
+		{
+			LoadedChunk.Value.LODIndex = INDEX_NONE;
+		}
+	}
+}
+
+void ULPPChunkManagerSubsystem::SetupChunkOccupancy ( const FGameplayTagContainer& NewOccupancyTagList )
+{
+	OccupancyTagList = NewOccupancyTagList;
+
+	ChunkOccupancyMap.Reset ( );
+
+	// Chunk skipped with the old tag may produce geometry now
+	TArray < FIntVector > SkippedChunkList;
+
+	for ( const auto& LoadedChunk : LoadedChunkMap )
+	{
+		if ( LoadedChunk.Value.bIsOccupancySkipped )
+		{
+			SkippedChunkList.Add ( LoadedChunk.Key );
+		}
+	}
+
+	for ( const FIntVector& ChunkID : SkippedChunkList )
+	{
+		RefreshOccupancySkippedChunk ( ChunkID );
+	}
+}
+
+void ULPPChunkManagerSubsystem::SetupChunkComponentNotify ( const bool bNewNotifyChunkComponent )
+{
+	bNotifyChunkComponent = bNewNotifyChunkComponent;
+}
+
 FVector ULPPChunkManagerSubsystem::GetChunkLocation ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex ) const
 {
 	if ( PositionComponentList.IsValidIndex ( ComponentIndex ) == false )
@@ -158,62 +315,194 @@ ULFPChunkedGridPositionComponent* ULPPChunkManagerSubsystem::GetPositionComponen
 	return PositionComponentList [ ComponentIndex ];
 }
 
+bool ULPPChunkManagerSubsystem::IsChunkOccupancySkipped ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex ) const
+{
+	const FLPPLoadedChunkData* LoadedChunkPtr = LoadedChunkMap.Find ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) );
+
+	return LoadedChunkPtr != nullptr && LoadedChunkPtr->bIsOccupancySkipped;
+}
+
 void ULPPChunkManagerSubsystem::LoadRegion ( const int32 ComponentIndex , const int32 RegionIndex , AActor* LoaderActor )
 {
-	if ( IsValid ( GetWorld ( ) ) == false )
+	if ( CanLoadChunk ( LoaderActor ) == false )
 	{
 		return;
 	}
 
-	if ( IsValid ( LoaderActor ) == false )
+	if ( PositionComponentList.IsValidIndex ( ComponentIndex ) == false )
 	{
 		return;
 	}
 
-	if ( IsValid ( ChunkActorClass ) == false )
+	const int32 RegionChunkNum = PositionComponentList [ ComponentIndex ]->GetChunkedGridSize ( ).Y;
+
+	TArray < FIntVector > ChunkIDList;
+
+	ChunkIDList.Reserve ( RegionChunkNum );
+
+	for ( int32 ChunkIndex = 0 ; ChunkIndex < RegionChunkNum ; ++ChunkIndex )
 	{
-		return;
+		ChunkIDList.Add ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) );
+	}
+
+	LoadChunkList ( ChunkIDList , LoaderActor );
+}
+
+AActor* ULPPChunkManagerSubsystem::LoadChunk ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex , AActor* LoaderActor )
+{
+	if ( CanLoadChunk ( LoaderActor ) == false )
+	{
+		return nullptr;
 	}
 
 	if ( PositionComponentList.IsValidIndex ( ComponentIndex ) == false )
+	{
+		return nullptr;
+	}
+
+	return LoadChunk_Internal ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) , LoaderActor );
+}
+
+bool ULPPChunkManagerSubsystem::UnloadChunk ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex , AActor* LoaderActor )
+{
+	if ( IsValid ( GetWorld ( ) ) == false )
+	{
+		return false;
+	}
+
+	if ( IsValid ( LoaderActor ) == false )
+	{
+		return false;
+	}
+
+	return UnloadChunk_Internal ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) , LoaderActor );
+}
+
+void ULPPChunkManagerSubsystem::LoadChunkList ( TConstArrayView < FIntVector > ChunkIDList , AActor* LoaderActor )
+{
+	if ( ChunkIDList.IsEmpty ( ) )
+	{
+		return;
+	}
+
+	if ( CanLoadChunk ( LoaderActor ) == false )
 	{
 		return;
 	}
 
-	for ( int32 ChunkIndex = 0 ; ChunkIndex < PositionComponentList [ ComponentIndex ]->GetChunkedGridSize ( ).Y ; ++ChunkIndex )
+	// Sort so chunk from the same component and region are touch together, descending because Tick pop AsyncLoadChunk from the back
+	TArray < FIntVector > SortedChunkIDList ( ChunkIDList );
+
+	SortedChunkIDList.Sort ( [] ( const FIntVector& A , const FIntVector& B )
+	{
+		if ( A.X != B.X )
+		{
+			return A.X > B.X;
+		}
+
+		if ( A.Y != B.Y )
+		{
+			return A.Y > B.Y;
+		}
+
+		return A.Z > B.Z;
+	} );
+
+	LoadedChunkMap.Reserve ( LoadedChunkMap.Num ( ) + SortedChunkIDList.Num ( ) );
+	AsyncLoadChunk.Reserve ( AsyncLoadChunk.Num ( ) + SortedChunkIDList.Num ( ) );
+
+	int32 CheckedComponentIndex = INDEX_NONE;
+	bool  bIsComponentValid     = false;
+
+	for ( const FIntVector& ChunkID : SortedChunkIDList )
 	{
-		LoadChunk ( ComponentIndex , RegionIndex , ChunkIndex , LoaderActor );
+		// Component only need to be validate once per group since the list is sorted
+		if ( ChunkID.X != CheckedComponentIndex )
+		{
+			CheckedComponentIndex = ChunkID.X;
+			bIsComponentValid     = PositionComponentList.IsValidIndex ( ChunkID.X );
+		}
+
+		if ( bIsComponentValid == false )
+		{
+			continue;
+		}
+
+		LoadChunk_Internal ( ChunkID , LoaderActor );
 	}
 }
 
-AActor* ULPPChunkManagerSubsystem::LoadChunk ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex , AActor* LoaderActor )
+void ULPPChunkManagerSubsystem::UnloadChunkList ( TConstArrayView < FIntVector > ChunkIDList , AActor* LoaderActor )
 {
+	if ( ChunkIDList.IsEmpty ( ) )
+	{
+		return;
+	}
+
 	if ( IsValid ( GetWorld ( ) ) == false )
 	{
-		return nullptr;
+		return;
 	}
 
 	if ( IsValid ( LoaderActor ) == false )
 	{
-		return nullptr;
+		return;
 	}
 
-	if ( IsValid ( ChunkActorClass ) == false )
+	TSet < FIntVector > PendingLoadRemoveList;
+
+	PendingLoadRemoveList.Reserve ( ChunkIDList.Num ( ) );
+
+	for ( const FIntVector& ChunkID : ChunkIDList )
 	{
-		return nullptr;
+		UnloadChunk_Internal ( ChunkID , LoaderActor , &PendingLoadRemoveList );
 	}
 
-	if ( PositionComponentList.IsValidIndex ( ComponentIndex ) == false )
+	// Remove all the chunk that never get notify in one pass
+	if ( PendingLoadRemoveList.IsEmpty ( ) == false )
 	{
-		return nullptr;
+		AsyncLoadChunk.RemoveAll ( [&] ( const FIntVector& ChunkID ) { return PendingLoadRemoveList.Contains ( ChunkID ); } );
+	}
+}
+
+void ULPPChunkManagerSubsystem::K2_LoadChunkList ( const TArray < FIntVector >& ChunkIDList , AActor* LoaderActor )
+{
+	LoadChunkList ( ChunkIDList , LoaderActor );
+}
+
+void ULPPChunkManagerSubsystem::K2_UnloadChunkList ( const TArray < FIntVector >& ChunkIDList , AActor* LoaderActor )
+{
+	UnloadChunkList ( ChunkIDList , LoaderActor );
+}
+
+AActor* ULPPChunkManagerSubsystem::LoadChunk_Internal ( const FIntVector& ChunkID , AActor* LoaderActor )
+{
+	FLPPLoadedChunkData& LoadedChunkRef = LoadedChunkMap.FindOrAdd ( ChunkID );
+
+	// New chunk that can never produce geometry don't need an actor
+	if ( OccupancyTagList.IsEmpty ( ) == false && IsValid ( LoadedChunkRef.ChunkActor ) == false && LoadedChunkRef.LoaderList.IsEmpty ( ) )
+	{
+		LoadedChunkRef.bIsOccupancySkipped = CanSkipChunkByOccupancy ( ChunkID );
 	}
 
-	FLPPLoadedChunkData& LoadedChunkRef = LoadedChunkMap.FindOrAdd ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) );
+	if ( LoadedChunkRef.bIsOccupancySkipped )
+	{
+		if ( LoadedChunkRef.LoaderList.Contains ( LoaderActor ) )
+		{
+			UE_LOG ( LogTemp , Error , TEXT ( "LoaderActor ( %s ) already in LoaderList" ) , *LoaderActor->GetName () );
+		}
+		else
+		{
+			LoadedChunkRef.LoaderList.Add ( LoaderActor );
+		}
+
+		return nullptr;
+	}
 
 	// Check do we already spawn the chunk actor
 	if ( IsValid ( LoadedChunkRef.ChunkActor ) == false )
 	{
-		LoadedChunkRef.ChunkActor = AllocateChunkActor ( ComponentIndex , RegionIndex , ChunkIndex );
+		LoadedChunkRef.ChunkActor = AllocateChunkActor ( ChunkID.X , ChunkID.Y , ChunkID.Z );
 	}
 
 	// Do we have a chunk actor?
@@ -230,31 +519,20 @@ AActor* ULPPChunkManagerSubsystem::LoadChunk ( const int32 ComponentIndex , cons
 
 			if ( LoadedChunkRef.LoaderList.Num ( ) == 1 )
 			{
-				AsyncLoadChunk.Add ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) );
+				LoadedChunkRef.bIsPendingLoad = true;
+
+				AsyncLoadChunk.Add ( ChunkID );
 			}
 		}
 
 		return LoadedChunkRef.ChunkActor.Get ( );
 	}
 
-
 	return nullptr;
 }
 
-bool ULPPChunkManagerSubsystem::UnloadChunk ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex , AActor* LoaderActor )
+bool ULPPChunkManagerSubsystem::UnloadChunk_Internal ( const FIntVector& ChunkID , AActor* LoaderActor , TSet < FIntVector >* PendingLoadRemoveList )
 {
-	if ( IsValid ( GetWorld ( ) ) == false )
-	{
-		return false;
-	}
-
-	if ( IsValid ( LoaderActor ) == false )
-	{
-		return false;
-	}
-
-	const FIntVector ChunkID ( ComponentIndex , RegionIndex , ChunkIndex );
-
 	// Are we loaded a chunk actor?
 	if ( FLPPLoadedChunkData* LoadedChunkPtr = LoadedChunkMap.Find ( ChunkID ) ; LoadedChunkPtr != nullptr )
 	{
@@ -269,19 +547,27 @@ bool ULPPChunkManagerSubsystem::UnloadChunk ( const int32 ComponentIndex , const
 				// This actor can be reuse
 				AvailableChunkList.Add ( LoadedChunkPtr->ChunkActor );
 
-				const int32 LoadListIndex = AsyncLoadChunk.IndexOfByKey ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) );
-
-				if ( LoadListIndex != INDEX_NONE )
+				if ( LoadedChunkPtr->bIsPendingLoad )
 				{
-					AsyncLoadChunk.RemoveAt ( LoadListIndex );
+					// Batch caller will remove all of them in one pass
+					if ( PendingLoadRemoveList != nullptr )
+					{
+						PendingLoadRemoveList->Add ( ChunkID );
+					}
+					else
+					{
+						AsyncLoadChunk.RemoveSingle ( ChunkID );
+					}
 				}
 				else
 				{
-					NotifyChunkUnload ( ComponentIndex , RegionIndex , ChunkIndex );
+					NotifyChunkUnload ( ChunkID.X , ChunkID.Y , ChunkID.Z );
 				}
 			}
 
 			LoadedChunkMap.Remove ( ChunkID );
+
+			EvictChunkOccupancy ( ChunkID );
 		}
 
 		return RemoveCount > 0;
@@ -290,66 +576,714 @@ bool ULPPChunkManagerSubsystem::UnloadChunk ( const int32 ComponentIndex , const
 	return false;
 }
 
-void ULPPChunkManagerSubsystem::RequestChunkUpdate ( const int32 ComponentIndex , const TArray < FIntVector >& GridDataIndexList , const bool bIsMetaUpdate )
+bool ULPPChunkManagerSubsystem::CanLoadChunk ( AActor* LoaderActor ) const
 {
-	check ( IsInGameThread ( ) )
+	return IsValid ( GetWorld ( ) ) && IsValid ( LoaderActor ) && IsValid ( ChunkActorClass );
+}
 
-	if ( ComponentIndex <= INDEX_NONE || IsValid ( PositionComponentList [ ComponentIndex ] ) == false )
+const FLPPChunkOccupancyData& ULPPChunkManagerSubsystem::GetChunkOccupancy ( const FIntVector& ChunkID )
+{
+	if ( const FLPPChunkOccupancyData* OccupancyDataPtr = ChunkOccupancyMap.Find ( ChunkID ) ; OccupancyDataPtr != nullptr )
 	{
-		return;
+		return *OccupancyDataPtr;
 	}
 
-	const bool bIsolateRegion = PositionComponentList [ ComponentIndex ]->IsIsolateRegion ( );
+	FLPPChunkOccupancyData OccupancyData;
 
-	TMap < FIntPoint , TSet < int32 > > BroadcastChunkIDList;
+	const ULFPChunkedTagDataComponent*      DataComponent     = GetDataComponent ( ChunkID.X );
+	const ULFPChunkedGridPositionComponent* PositionComponent = GetPositionComponent ( ChunkID.X );
 
-	for ( const FIntVector& GridDataIndex : GridDataIndexList )
+	if ( IsValid ( DataComponent ) && IsValid ( PositionComponent ) )
 	{
-		if ( GridDataIndex.GetMin ( ) <= INDEX_NONE )
+		bool bHasSolidTag = false;
+
+		// Chunk tag list hold every distinct tag in the chunk, no solid tag mean empty without scanning
+		for ( const FGameplayTag& ChunkTag : DataComponent->GetCellTagList ( ChunkID.Y , ChunkID.Z ) )
 		{
-			continue;
-		}
+			if ( ChunkTag.MatchesAny ( OccupancyTagList ) )
+			{
+				bHasSolidTag = true;
 
-		BroadcastChunkIDList.FindOrAdd ( FIntPoint ( GridDataIndex.X , GridDataIndex.Y ) ).Add ( GridDataIndex.Z );
+				break;
+			}
+		}
 
-		if ( bIsMetaUpdate == false )
+		if ( bHasSolidTag == false )
 		{
-			const FIntVector DataPos = PositionComponentList [ ComponentIndex ]->ToDataGridPosition ( FIntVector ( 0 , 0 , GridDataIndex.Z ) );
+			OccupancyData.bIsEmpty        = true;
+			OccupancyData.BorderEmptyMask = MAX_uint32;
+		}
+		else
+		{
+			const FIntVector DataGridSize = PositionComponent->GetDataGridSize ( );
 
-			// Send update to any nearby chunk too if loaded
-			for ( const FIntVector& GridEdgeDir : ULFPGridLibrary::GetGridEdgeDirection ( DataPos , PositionComponentList [ ComponentIndex ]->GetDataGridSize ( ) ) )
-			{
-				const FIntPoint EdgeChunkIndex = PositionComponentList [ ComponentIndex ]->AddOffsetToChunkGridIndex ( FIntPoint ( GridDataIndex.X , GridDataIndex.Y ) , GridEdgeDir );
+			// One match per distinct tag, neighbour cell mostly share tag so last entry is check first
+			TArray < FGameplayTag > PaletteTagList;
+			TArray < bool >         PaletteSolidList;
+			int32                   LastPaletteIndex = INDEX_NONE;
 
-				if ( EdgeChunkIndex.X == INDEX_NONE || EdgeChunkIndex.Y == INDEX_NONE )
+			const auto IsCellSolid = [&] ( const FGameplayTag& CellTag )
+			{
+				if ( PaletteTagList.IsValidIndex ( LastPaletteIndex ) == false || PaletteTagList [ LastPaletteIndex ] != CellTag )
 				{
-					continue;
+					LastPaletteIndex = PaletteTagList.Find ( CellTag );
+
+					if ( LastPaletteIndex == INDEX_NONE )
+					{
+						LastPaletteIndex = PaletteTagList.Add ( CellTag );
+
+						PaletteSolidList.Add ( CellTag.MatchesAny ( OccupancyTagList ) );
+					}
 				}
 
-				if ( bIsolateRegion && EdgeChunkIndex.X != GridDataIndex.X )
+				return PaletteSolidList [ LastPaletteIndex ];
+			};
+
+			bool bHasSolid = false;
+			bool bHasEmpty = false;
+
+			// Clear the bit when a cell break the uniform state
+			uint32 BorderEmptyMask = MAX_uint32;
+			uint32 BorderFullMask  = MAX_uint32;
+
+			// Mixed chunk with no uniform border left can't change anymore
+			const auto IsSettled = [&] ( )
+			{
+				return bHasSolid && bHasEmpty && BorderEmptyMask == 0 && BorderFullMask == 0;
+			};
+
+			for ( int32 Z = 0 ; Z < DataGridSize.Z && IsSettled ( ) == false ; ++Z )
+			{
+				for ( int32 Y = 0 ; Y < DataGridSize.Y && IsSettled ( ) == false ; ++Y )
 				{
-					continue;
+					const int32 DataRowIndex = ULFPGridLibrary::ToGridIndex ( FIntVector ( 0 , Y , Z ) , DataGridSize );
+					const bool  bIsBorderRow = Y == 0 || Y == DataGridSize.Y - 1 || Z == 0 || Z == DataGridSize.Z - 1;
+
+					for ( int32 X = 0 ; X < DataGridSize.X ; ++X )
+					{
+						const bool bIsSolid = IsCellSolid ( DataComponent->GetCellTag ( ChunkID.Y , ChunkID.Z , DataRowIndex + X ) );
+
+						bHasSolid |= bIsSolid;
+						bHasEmpty |= bIsSolid == false;
+
+						// Interior cell is not on any border
+						if ( bIsBorderRow == false && X != 0 && X != DataGridSize.X - 1 )
+						{
+							continue;
+						}
+
+						// Which side of each axis this cell is on, 0 is always include
+						const FIntVector MinSide ( X == 0 ? -1 : 0 , Y == 0 ? -1 : 0 , Z == 0 ? -1 : 0 );
+						const FIntVector MaxSide ( X == DataGridSize.X - 1 ? 1 : 0 , Y == DataGridSize.Y - 1 ? 1 : 0 , Z == DataGridSize.Z - 1 ? 1 : 0 );
+
+						for ( int32 Dir_X = MinSide.X ; Dir_X <= MaxSide.X ; ++Dir_X )
+						{
+							for ( int32 Dir_Y = MinSide.Y ; Dir_Y <= MaxSide.Y ; ++Dir_Y )
+							{
+								for ( int32 Dir_Z = MinSide.Z ; Dir_Z <= MaxSide.Z ; ++Dir_Z )
+								{
+									const uint32 DirectionBit = 1u << ToBorderDirectionIndex ( FIntVector ( Dir_X , Dir_Y , Dir_Z ) );
+
+									if ( bIsSolid )
+									{
+										BorderEmptyMask &= ~DirectionBit;
+									}
+									else
+									{
+										BorderFullMask &= ~DirectionBit;
+									}
+								}
+							}
+						}
+					}
 				}
-
-				BroadcastChunkIDList.FindOrAdd ( EdgeChunkIndex );
 			}
+
+			OccupancyData.bIsEmpty        = bHasSolid == false;
+			OccupancyData.bIsFull         = bHasEmpty == false;
+			OccupancyData.BorderEmptyMask = BorderEmptyMask;
+			OccupancyData.BorderFullMask  = BorderFullMask;
 		}
 	}
 
-	for ( const TPair < FIntPoint , TSet < int32 > >& ChunkID : BroadcastChunkIDList )
+	return ChunkOccupancyMap.Add ( ChunkID , OccupancyData );
+}
+
+bool ULPPChunkManagerSubsystem::CanSkipChunkByOccupancy ( const FIntVector& ChunkID )
+{
+	if ( OccupancyTagList.IsEmpty ( ) )
 	{
-		check ( ChunkID.Key.X > INDEX_NONE && ChunkID.Key.Y > INDEX_NONE );
+		return false;
+	}
 
-		auto& ActionData = BatchUpdateList.FindOrAdd ( FIntVector ( ComponentIndex , ChunkID.Key.X , ChunkID.Key.Y ) );
+	const ULFPChunkedTagDataComponent*      DataComponent     = GetDataComponent ( ChunkID.X );
+	const ULFPChunkedGridPositionComponent* PositionComponent = GetPositionComponent ( ChunkID.X );
 
-		ActionData.UpdateDataIndexList.Append ( ChunkID.Value );
-		ActionData.bIsMetaUpdate &= bIsMetaUpdate;
+	if ( IsValid ( DataComponent ) == false || IsValid ( PositionComponent ) == false )
+	{
+		return false;
 	}
-}
 
-void ULPPChunkManagerSubsystem::NotifyChunkLoad ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex ) const
-{
-	const FLPPLoadedChunkData* LoadedChunkRef = LoadedChunkMap.Find ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) );
+	if ( DataComponent->IsChunkIndexValid ( ChunkID.Y , ChunkID.Z ) == false )
+	{
+		return false;
+	}
+
+	const FLPPChunkOccupancyData SelfOccupancy = GetChunkOccupancy ( ChunkID );
+
+	if ( SelfOccupancy.bIsEmpty == false && SelfOccupancy.bIsFull == false )
+	{
+		return false;
+	}
+
+	const bool bIsolateRegion = PositionComponent->IsIsolateRegion ( );
+	const bool bIsolateChunk  = PositionComponent->IsIsolateChunk ( );
+
+	// Mesh sample one cell from all 26 neighbour, every sampled border must be in the same state as this chunk
+	for ( int32 Dir_X = -1 ; Dir_X <= 1 ; ++Dir_X )
+	{
+		for ( int32 Dir_Y = -1 ; Dir_Y <= 1 ; ++Dir_Y )
+		{
+			for ( int32 Dir_Z = -1 ; Dir_Z <= 1 ; ++Dir_Z )
+			{
+				const FIntVector Direction ( Dir_X , Dir_Y , Dir_Z );
+
+				if ( Direction == FIntVector::ZeroValue )
+				{
+					continue;
+				}
+
+				const FIntPoint NeighbourIndex = PositionComponent->AddOffsetToChunkGridIndex ( FIntPoint ( ChunkID.Y , ChunkID.Z ) , Direction );
+
+				// Same rule as the mesher, out of bound or isolated neighbour is sample as empty
+				const bool bIsNeighbourEmpty = NeighbourIndex.X == INDEX_NONE || NeighbourIndex.Y == INDEX_NONE ||
+					( bIsolateRegion && NeighbourIndex.X != ChunkID.Y ) ||
+					( bIsolateChunk && NeighbourIndex.Y != ChunkID.Z );
+
+				if ( bIsNeighbourEmpty )
+				{
+					if ( SelfOccupancy.bIsFull )
+					{
+						return false;
+					}
+
+					continue;
+				}
+
+				const FLPPChunkOccupancyData& NeighbourOccupancy = GetChunkOccupancy ( FIntVector ( ChunkID.X , NeighbourIndex.X , NeighbourIndex.Y ) );
+				const uint32                  FacingBit          = 1u << ( 26 - ToBorderDirectionIndex ( Direction ) );
+
+				if ( ( ( SelfOccupancy.bIsEmpty ? NeighbourOccupancy.BorderEmptyMask : NeighbourOccupancy.BorderFullMask ) & FacingBit ) == 0 )
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+void ULPPChunkManagerSubsystem::RefreshOccupancySkippedChunk ( const FIntVector& ChunkID )
+{
+	FLPPLoadedChunkData* LoadedChunkPtr = LoadedChunkMap.Find ( ChunkID );
+
+	if ( LoadedChunkPtr == nullptr || LoadedChunkPtr->bIsOccupancySkipped == false )
+	{
+		return;
+	}
+
+	if ( CanSkipChunkByOccupancy ( ChunkID ) )
+	{
+		return;
+	}
+
+	LoadedChunkPtr->bIsOccupancySkipped = false;
+	LoadedChunkPtr->ChunkActor          = AllocateChunkActor ( ChunkID.X , ChunkID.Y , ChunkID.Z );
+
+	if ( IsValid ( LoadedChunkPtr->ChunkActor ) && LoadedChunkPtr->LoaderList.IsEmpty ( ) == false )
+	{
+		LoadedChunkPtr->bIsPendingLoad = true;
+
+		AsyncLoadChunk.Add ( ChunkID );
+	}
+}
+
+void ULPPChunkManagerSubsystem::EvictChunkOccupancy ( const FIntVector& ChunkID )
+{
+	if ( ChunkOccupancyMap.IsEmpty ( ) )
+	{
+		return;
+	}
+
+	ChunkOccupancyMap.Remove ( ChunkID );
+
+	const ULFPChunkedGridPositionComponent* PositionComponent = GetPositionComponent ( ChunkID.X );
+
+	if ( IsValid ( PositionComponent ) == false )
+	{
+		return;
+	}
+
+	// Neighbour entry is only add by a loaded chunk sampling its border, keep the one that is still loaded
+	for ( int32 Dir_X = -1 ; Dir_X <= 1 ; ++Dir_X )
+	{
+		for ( int32 Dir_Y = -1 ; Dir_Y <= 1 ; ++Dir_Y )
+		{
+			for ( int32 Dir_Z = -1 ; Dir_Z <= 1 ; ++Dir_Z )
+			{
+				const FIntVector Direction ( Dir_X , Dir_Y , Dir_Z );
+
+				if ( Direction == FIntVector::ZeroValue )
+				{
+					continue;
+				}
+
+				const FIntPoint NeighbourIndex = PositionComponent->AddOffsetToChunkGridIndex ( FIntPoint ( ChunkID.Y , ChunkID.Z ) , Direction );
+
+				if ( NeighbourIndex.X == INDEX_NONE || NeighbourIndex.Y == INDEX_NONE )
+				{
+					continue;
+				}
+
+				const FIntVector NeighbourChunkID ( ChunkID.X , NeighbourIndex.X , NeighbourIndex.Y );
+
+				if ( LoadedChunkMap.Contains ( NeighbourChunkID ) == false )
+				{
+					ChunkOccupancyMap.Remove ( NeighbourChunkID );
+				}
+			}
+		}
+	}
+}
+
+int32 ULPPChunkManagerSubsystem::ToBorderDirectionIndex ( const FIntVector& Direction )
+{
+	return ( Direction.X + 1 ) + ( Direction.Y + 1 ) * 3 + ( Direction.Z + 1 ) * 9;
+}
+
+void ULPPChunkManagerSubsystem::RegisterStreamingSource ( AActor* SourceActor , const int32 LoadDistance , const int32 UnloadDistance )
+{
+	if ( IsValid ( SourceActor ) == false )
+	{
+		return;
+	}
+
+	const int32 NewLoadDistance   = FMath::Max ( LoadDistance , 0 );
+	const int32 NewUnloadDistance = FMath::Max ( UnloadDistance , NewLoadDistance );
+
+	FLPPChunkStreamingSourceData& SourceData = StreamingSourceMap.FindOrAdd ( SourceActor );
+
+	if ( ( SourceData.LoadDistance != NewLoadDistance || SourceData.UnloadDistance != NewUnloadDistance ) && SourceData.CenterChunkID != FIntVector::NoneValue )
+	{
+		RemoveSourceFromBucket ( SourceData.CenterChunkID , FIntPoint ( SourceData.LoadDistance , SourceData.UnloadDistance ) );
+
+		SourceData.CenterChunkID = FIntVector::NoneValue;
+
+		DirtyStreamingSourceList.Add ( SourceActor );
+	}
+
+	SourceData.LoadDistance   = NewLoadDistance;
+	SourceData.UnloadDistance = NewUnloadDistance;
+
+	SourceActor->OnDestroyed.AddUniqueDynamic ( this , &ULPPChunkManagerSubsystem::OnStreamingSourceDestroyed );
+}
+
+void ULPPChunkManagerSubsystem::UnregisterStreamingSource ( AActor* SourceActor )
+{
+	FLPPChunkStreamingSourceData SourceData;
+
+	if ( StreamingSourceMap.RemoveAndCopyValue ( SourceActor , SourceData ) == false )
+	{
+		return;
+	}
+
+	if ( SourceData.CenterChunkID != FIntVector::NoneValue )
+	{
+		RemoveSourceFromBucket ( SourceData.CenterChunkID , FIntPoint ( SourceData.LoadDistance , SourceData.UnloadDistance ) );
+	}
+
+	DirtyStreamingSourceList.Remove ( SourceActor );
+
+	if ( IsValid ( SourceActor ) )
+	{
+		SourceActor->OnDestroyed.RemoveDynamic ( this , &ULPPChunkManagerSubsystem::OnStreamingSourceDestroyed );
+	}
+}
+
+void ULPPChunkManagerSubsystem::UpdateStreamingSource ( AActor* SourceActor , const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex )
+{
+	FLPPChunkStreamingSourceData* SourceDataPtr = StreamingSourceMap.Find ( SourceActor );
+
+	if ( SourceDataPtr == nullptr )
+	{
+		UE_LOG ( LogTemp , Error , TEXT ( "SourceActor ( %s ) is not a registered streaming source" ) , *GetNameSafe ( SourceActor ) );
+
+		return;
+	}
+
+	SourceDataPtr->PendingCenterChunkID = FIntVector ( ComponentIndex , RegionIndex , ChunkIndex );
+
+	DirtyStreamingSourceList.Add ( SourceActor );
+}
+
+void ULPPChunkManagerSubsystem::ApplyStreamingSourceChange ( )
+{
+	if ( DirtyStreamingSourceList.IsEmpty ( ) == false )
+	{
+		for ( const TWeakObjectPtr < AActor >& SourceActor : DirtyStreamingSourceList )
+		{
+			FLPPChunkStreamingSourceData* SourceDataPtr = StreamingSourceMap.Find ( SourceActor );
+
+			if ( SourceDataPtr == nullptr || SourceDataPtr->PendingCenterChunkID == SourceDataPtr->CenterChunkID )
+			{
+				continue;
+			}
+
+			MoveSourceToBucket ( SourceDataPtr->CenterChunkID , SourceDataPtr->PendingCenterChunkID , FIntPoint ( SourceDataPtr->LoadDistance , SourceDataPtr->UnloadDistance ) );
+
+			SourceDataPtr->CenterChunkID = SourceDataPtr->PendingCenterChunkID;
+		}
+
+		DirtyStreamingSourceList.Reset ( );
+	}
+
+	if ( PendingStreamUnloadList.IsEmpty ( ) && PendingStreamLoadList.IsEmpty ( ) )
+	{
+		return;
+	}
+
+	AActor* StreamingLoaderActor = GetStreamingLoaderActor ( );
+
+	// Only the chunk that leave or enter the union reach here
+	UnloadChunkList ( PendingStreamUnloadList.Array ( ) , StreamingLoaderActor );
+
+	PendingStreamUnloadList.Reset ( );
+
+	// Interest is already held, keep the pending chunk until the manager can load it ( Chunk actor class not setup yet )
+	if ( CanLoadChunk ( StreamingLoaderActor ) == false )
+	{
+		return;
+	}
+
+	LoadChunkList ( PendingStreamLoadList.Array ( ) , StreamingLoaderActor );
+
+	PendingStreamLoadList.Reset ( );
+}
+
+void ULPPChunkManagerSubsystem::MoveSourceToBucket ( const FIntVector& OldCenterChunkID , const FIntVector& NewCenterChunkID , const FIntPoint& StreamDistance )
+{
+	const TPair < FIntVector , FIntPoint > OldBucketKey ( OldCenterChunkID , StreamDistance );
+	const TPair < FIntVector , FIntPoint > NewBucketKey ( NewCenterChunkID , StreamDistance );
+
+	if ( NewCenterChunkID == FIntVector::NoneValue )
+	{
+		RemoveSourceFromBucket ( OldCenterChunkID , StreamDistance );
+
+		return;
+	}
+
+	// Other source already cover this bucket
+	if ( FLPPChunkStreamingBucketData* NewBucketDataPtr = StreamingBucketMap.Find ( NewBucketKey ) ; NewBucketDataPtr != nullptr )
+	{
+		NewBucketDataPtr->SourceCount += 1;
+
+		RemoveSourceFromBucket ( OldCenterChunkID , StreamDistance );
+
+		return;
+	}
+
+	FLPPChunkStreamingBucketData NewBucketData;
+
+	NewBucketData.SourceCount = 1;
+
+	FLPPChunkStreamingBucketData* OldBucketDataPtr = OldCenterChunkID != FIntVector::NoneValue ? StreamingBucketMap.Find ( OldBucketKey ) : nullptr;
+
+	FIntVector MoveOffset;
+
+	if ( OldBucketDataPtr != nullptr && OldCenterChunkID.X == NewCenterChunkID.X && GetStreamingMoveOffset ( OldCenterChunkID , NewCenterChunkID , StreamDistance.Y * 2 , MoveOffset ) )
+	{
+		if ( OldBucketDataPtr->SourceCount == 1 )
+		{
+			// Last source of the old bucket, take over its chunk and interest
+			NewBucketData.ChunkIDList = MoveTemp ( OldBucketDataPtr->ChunkIDList );
+
+			StreamingBucketMap.Remove ( OldBucketKey );
+		}
+		else
+		{
+			OldBucketDataPtr->SourceCount -= 1;
+
+			NewBucketData.ChunkIDList = OldBucketDataPtr->ChunkIDList;
+
+			for ( const FIntVector& ChunkID : NewBucketData.ChunkIDList )
+			{
+				IncreaseChunkInterest ( ChunkID );
+			}
+		}
+
+		// Held chunk is always inside the old unload cube, only the part that is outside the new one can leave
+		ReleaseBucketChunk ( NewBucketData , OldCenterChunkID , StreamDistance.Y , MoveOffset - FIntVector ( StreamDistance.Y ) , MoveOffset + FIntVector ( StreamDistance.Y ) );
+
+		// Old load cube is still held, only the part that is outside it can enter
+		HoldBucketChunk ( NewBucketData , NewCenterChunkID , StreamDistance.X , FIntVector ( -StreamDistance.X ) - MoveOffset , FIntVector ( StreamDistance.X ) - MoveOffset );
+	}
+	else
+	{
+		RemoveSourceFromBucket ( OldCenterChunkID , StreamDistance );
+
+		HoldBucketChunk ( NewBucketData , NewCenterChunkID , StreamDistance.X , LPPChunkStreamingHelper::NoExcludeMin , LPPChunkStreamingHelper::NoExcludeMax );
+	}
+
+	StreamingBucketMap.Add ( NewBucketKey , MoveTemp ( NewBucketData ) );
+}
+
+void ULPPChunkManagerSubsystem::RemoveSourceFromBucket ( const FIntVector& CenterChunkID , const FIntPoint& StreamDistance )
+{
+	const TPair < FIntVector , FIntPoint > BucketKey ( CenterChunkID , StreamDistance );
+
+	FLPPChunkStreamingBucketData* BucketDataPtr = StreamingBucketMap.Find ( BucketKey );
+
+	if ( BucketDataPtr == nullptr )
+	{
+		return;
+	}
+
+	BucketDataPtr->SourceCount -= 1;
+
+	if ( BucketDataPtr->SourceCount > 0 )
+	{
+		return;
+	}
+
+	for ( const FIntVector& ChunkID : BucketDataPtr->ChunkIDList )
+	{
+		DecreaseChunkInterest ( ChunkID );
+	}
+
+	StreamingBucketMap.Remove ( BucketKey );
+}
+
+void ULPPChunkManagerSubsystem::HoldBucketChunk ( FLPPChunkStreamingBucketData& BucketData , const FIntVector& CenterChunkID , const int32 LoadDistance , const FIntVector& ExcludeMin , const FIntVector& ExcludeMax )
+{
+	const ULFPChunkedTagDataComponent*      DataComponent     = GetDataComponent ( CenterChunkID.X );
+	const ULFPChunkedGridPositionComponent* PositionComponent = GetPositionComponent ( CenterChunkID.X );
+
+	if ( IsValid ( DataComponent ) == false || IsValid ( PositionComponent ) == false )
+	{
+		return;
+	}
+
+	LPPChunkStreamingHelper::ForEachOffsetOutsideBox ( LoadDistance , ExcludeMin , ExcludeMax , [&] ( const FIntVector& Offset )
+	{
+		const FIntPoint ChunkGridIndex = PositionComponent->AddOffsetToChunkGridIndex ( FIntPoint ( CenterChunkID.Y , CenterChunkID.Z ) , Offset );
+
+		if ( DataComponent->IsChunkIndexValid ( ChunkGridIndex.X , ChunkGridIndex.Y ) == false )
+		{
+			return;
+		}
+
+		bool bIsAlreadyHeld = false;
+
+		BucketData.ChunkIDList.Add ( FIntVector ( CenterChunkID.X , ChunkGridIndex.X , ChunkGridIndex.Y ) , &bIsAlreadyHeld );
+
+		if ( bIsAlreadyHeld == false )
+		{
+			IncreaseChunkInterest ( FIntVector ( CenterChunkID.X , ChunkGridIndex.X , ChunkGridIndex.Y ) );
+		}
+	} );
+}
+
+void ULPPChunkManagerSubsystem::ReleaseBucketChunk ( FLPPChunkStreamingBucketData& BucketData , const FIntVector& OldCenterChunkID , const int32 UnloadDistance , const FIntVector& ExcludeMin , const FIntVector& ExcludeMax )
+{
+	const ULFPChunkedGridPositionComponent* PositionComponent = GetPositionComponent ( OldCenterChunkID.X );
+
+	if ( IsValid ( PositionComponent ) == false )
+	{
+		return;
+	}
+
+	LPPChunkStreamingHelper::ForEachOffsetOutsideBox ( UnloadDistance , ExcludeMin , ExcludeMax , [&] ( const FIntVector& Offset )
+	{
+		const FIntPoint  ChunkGridIndex = PositionComponent->AddOffsetToChunkGridIndex ( FIntPoint ( OldCenterChunkID.Y , OldCenterChunkID.Z ) , Offset );
+		const FIntVector ChunkID ( OldCenterChunkID.X , ChunkGridIndex.X , ChunkGridIndex.Y );
+
+		if ( BucketData.ChunkIDList.Remove ( ChunkID ) > 0 )
+		{
+			DecreaseChunkInterest ( ChunkID );
+		}
+	} );
+}
+
+bool ULPPChunkManagerSubsystem::GetStreamingMoveOffset ( const FIntVector& OldCenterChunkID , const FIntVector& NewCenterChunkID , const int32 MaxOffset , FIntVector& OutMoveOffset ) const
+{
+	const ULFPChunkedGridPositionComponent* PositionComponent = GetPositionComponent ( OldCenterChunkID.X );
+
+	if ( IsValid ( PositionComponent ) == false )
+	{
+		return false;
+	}
+
+	const FIntPoint  OldChunkGridIndex ( OldCenterChunkID.Y , OldCenterChunkID.Z );
+	const FIntPoint  NewChunkGridIndex ( NewCenterChunkID.Y , NewCenterChunkID.Z );
+	const FIntVector MoveDistance = PositionComponent->GetDistanceToChunkGridIndex ( NewChunkGridIndex , OldChunkGridIndex );
+	const FIntVector MoveAmount ( FMath::Abs ( MoveDistance.X ) , FMath::Abs ( MoveDistance.Y ) , FMath::Abs ( MoveDistance.Z ) );
+
+	// Old and new cube don't overlap , nothing to reuse
+	if ( MoveAmount.GetMax ( ) > MaxOffset )
+	{
+		return false;
+	}
+
+	// Distance don't carry a direction we can trust, probe the sign until the offset land on the new center
+	for ( int32 SignIndex = 0 ; SignIndex < 8 ; ++SignIndex )
+	{
+		const FIntVector MoveOffset (
+			( SignIndex & 1 ) == 0 ? MoveAmount.X : -MoveAmount.X ,
+			( SignIndex & 2 ) == 0 ? MoveAmount.Y : -MoveAmount.Y ,
+			( SignIndex & 4 ) == 0 ? MoveAmount.Z : -MoveAmount.Z
+			);
+
+		if ( PositionComponent->AddOffsetToChunkGridIndex ( OldChunkGridIndex , MoveOffset ) == NewChunkGridIndex )
+		{
+			OutMoveOffset = MoveOffset;
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ULPPChunkManagerSubsystem::IncreaseChunkInterest ( const FIntVector& ChunkID )
+{
+	int32& InterestCount = ChunkInterestCountMap.FindOrAdd ( ChunkID );
+
+	InterestCount += 1;
+
+	if ( InterestCount == 1 )
+	{
+		// Leave and enter on the same tick cancel out
+		if ( PendingStreamUnloadList.Remove ( ChunkID ) == 0 )
+		{
+			PendingStreamLoadList.Add ( ChunkID );
+		}
+	}
+}
+
+void ULPPChunkManagerSubsystem::DecreaseChunkInterest ( const FIntVector& ChunkID )
+{
+	int32* InterestCountPtr = ChunkInterestCountMap.Find ( ChunkID );
+
+	if ( InterestCountPtr == nullptr )
+	{
+		return;
+	}
+
+	*InterestCountPtr -= 1;
+
+	if ( *InterestCountPtr <= 0 )
+	{
+		ChunkInterestCountMap.Remove ( ChunkID );
+
+		// Leave and enter on the same tick cancel out
+		if ( PendingStreamLoadList.Remove ( ChunkID ) == 0 )
+		{
+			PendingStreamUnloadList.Add ( ChunkID );
+		}
+	}
+}
+
+AActor* ULPPChunkManagerSubsystem::GetStreamingLoaderActor ( ) const
+{
+	return IsValid ( GetWorld ( ) ) ? GetWorld ( )->GetWorldSettings ( ) : nullptr;
+}
+
+void ULPPChunkManagerSubsystem::OnStreamingSourceDestroyed ( AActor* DestroyedActor )
+{
+	UnregisterStreamingSource ( DestroyedActor );
+}
+
+void ULPPChunkManagerSubsystem::RequestChunkUpdate ( const int32 ComponentIndex , const TArray < FIntVector >& GridDataIndexList , const bool bIsMetaUpdate )
+{
+	check ( IsInGameThread ( ) )
+
+	if ( ComponentIndex <= INDEX_NONE || IsValid ( PositionComponentList [ ComponentIndex ] ) == false )
+	{
+		return;
+	}
+
+	const bool bIsolateRegion = PositionComponentList [ ComponentIndex ]->IsIsolateRegion ( );
+
+	TMap < FIntPoint , TSet < int32 > > BroadcastChunkIDList;
+
+	/* Chunk that own an edited cell, edge neighbour is only in BroadcastChunkIDList */
+	TSet < FIntPoint > EditedChunkIDList;
+
+	for ( const FIntVector& GridDataIndex : GridDataIndexList )
+	{
+		if ( GridDataIndex.GetMin ( ) <= INDEX_NONE )
+		{
+			continue;
+		}
+
+		BroadcastChunkIDList.FindOrAdd ( FIntPoint ( GridDataIndex.X , GridDataIndex.Y ) ).Add ( GridDataIndex.Z );
+		EditedChunkIDList.Add ( FIntPoint ( GridDataIndex.X , GridDataIndex.Y ) );
+
+		if ( bIsMetaUpdate == false )
+		{
+			const FIntVector DataPos = PositionComponentList [ ComponentIndex ]->ToDataGridPosition ( FIntVector ( 0 , 0 , GridDataIndex.Z ) );
+
+			// Send update to any nearby chunk too if loaded
+			for ( const FIntVector& GridEdgeDir : ULFPGridLibrary::GetGridEdgeDirection ( DataPos , PositionComponentList [ ComponentIndex ]->GetDataGridSize ( ) ) )
+			{
+				// Neighbour cell next to the edit, its marching cell share a corner with the edited cell so neighbour can update partially
+				const FIntVector EdgeDataIndex = PositionComponentList [ ComponentIndex ]->AddOffsetToDataGridIndex ( GridDataIndex , GridEdgeDir );
+
+				if ( EdgeDataIndex.GetMin ( ) <= INDEX_NONE )
+				{
+					continue;
+				}
+
+				if ( bIsolateRegion && EdgeDataIndex.X != GridDataIndex.X )
+				{
+					continue;
+				}
+
+				BroadcastChunkIDList.FindOrAdd ( FIntPoint ( EdgeDataIndex.X , EdgeDataIndex.Y ) ).Add ( EdgeDataIndex.Z );
+			}
+		}
+	}
+
+	for ( const TPair < FIntPoint , TSet < int32 > >& ChunkID : BroadcastChunkIDList )
+	{
+		check ( ChunkID.Key.X > INDEX_NONE && ChunkID.Key.Y > INDEX_NONE );
+
+		auto& ActionData = BatchUpdateList.FindOrAdd ( FIntVector ( ComponentIndex , ChunkID.Key.X , ChunkID.Key.Y ) );
+
+		ActionData.UpdateDataIndexList.Append ( ChunkID.Value );
+		ActionData.bIsMetaUpdate &= bIsMetaUpdate;
+	}
+
+	if ( bIsMetaUpdate == false && OccupancyTagList.IsEmpty ( ) == false )
+	{
+		// Only chunk with edited cell has its occupancy change
+		for ( const FIntPoint& ChunkID : EditedChunkIDList )
+		{
+			ChunkOccupancyMap.Remove ( FIntVector ( ComponentIndex , ChunkID.X , ChunkID.Y ) );
+		}
+
+		// Edge neighbour sample the edited border, so they may need an actor now
+		for ( const TPair < FIntPoint , TSet < int32 > >& ChunkID : BroadcastChunkIDList )
+		{
+			RefreshOccupancySkippedChunk ( FIntVector ( ComponentIndex , ChunkID.Key.X , ChunkID.Key.Y ) );
+		}
+	}
+}
+
+void ULPPChunkManagerSubsystem::NotifyChunkLoad ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex ) const
+{
+	const FLPPLoadedChunkData* LoadedChunkRef = LoadedChunkMap.Find ( FIntVector ( ComponentIndex , RegionIndex , ChunkIndex ) );
 
 	// Do we have a chunk actor?
 	if ( LoadedChunkRef != nullptr && IsValid ( LoadedChunkRef->ChunkActor ) )
@@ -394,7 +1328,22 @@ void ULPPChunkManagerSubsystem::NotifyChunkUpdate ( const int32 ComponentIndex ,
 		// Does the chunk actor we spawn have the correct interface?
 		if ( ChunkRef->ChunkActor->Implements < ULPPChunkActorInterface > ( ) )
 		{
-			ILPPChunkActorInterface::Execute_OnRequestChunkUpdate ( ChunkRef->ChunkActor , ActionData.UpdateDataIndexList.Array ( ) , ActionData.bIsMetaUpdate );
+			const TArray < int32 > DataIndexList = ActionData.UpdateDataIndexList.Array ( );
+
+			ILPPChunkActorInterface::Execute_OnRequestChunkUpdate ( ChunkRef->ChunkActor , DataIndexList , ActionData.bIsMetaUpdate );
+
+			if ( bNotifyChunkComponent )
+			{
+				TInlineComponentArray < UActorComponent* > ComponentList ( ChunkRef->ChunkActor );
+
+				for ( UActorComponent* Component : ComponentList )
+				{
+					if ( Component->Implements < ULPPChunkActorInterface > ( ) )
+					{
+						ILPPChunkActorInterface::Execute_OnRequestChunkUpdate ( Component , DataIndexList , ActionData.bIsMetaUpdate );
+					}
+				}
+			}
 		}
 		else
 		{
@@ -403,6 +1352,149 @@ void ULPPChunkManagerSubsystem::NotifyChunkUpdate ( const int32 ComponentIndex ,
 	}
 }
 
+void ULPPChunkManagerSubsystem::NotifyChunkLODChanged ( const FIntVector& ChunkID , const int32 LODIndex ) const
+{
+	if ( const FLPPLoadedChunkData* ChunkRef = LoadedChunkMap.Find ( ChunkID ) ; ChunkRef != nullptr && IsValid ( ChunkRef->ChunkActor ) )
+	{
+		// Does the chunk actor we spawn have the correct interface?
+		if ( ChunkRef->ChunkActor->Implements < ULPPChunkActorInterface > ( ) )
+		{
+			ILPPChunkActorInterface::Execute_OnLODChanged ( ChunkRef->ChunkActor , LODIndex );
+
+			if ( bNotifyChunkComponent )
+			{
+				TInlineComponentArray < UActorComponent* > ComponentList ( ChunkRef->ChunkActor );
+
+				for ( UActorComponent* Component : ComponentList )
+				{
+					if ( Component->Implements < ULPPChunkActorInterface > ( ) )
+					{
+						ILPPChunkActorInterface::Execute_OnLODChanged ( Component , LODIndex );
+					}
+				}
+			}
+		}
+		else
+		{
+			UE_LOG ( LogTemp , Error , TEXT ( "ChunkActor ( %s) does not implement ULPPChunkActorInterface" ) , *ChunkRef->ChunkActor->GetName () );
+		}
+	}
+}
+
+void ULPPChunkManagerSubsystem::UpdateChunkLOD ( )
+{
+	for ( auto& LoadedChunk : LoadedChunkMap )
+	{
+		// Will be assign when the load is notify
+		if ( LoadedChunk.Value.bIsPendingLoad || IsValid ( LoadedChunk.Value.ChunkActor ) == false )
+		{
+			continue;
+		}
+
+		const int32 NewLODIndex = ComputeChunkLOD ( LoadedChunk.Key , LoadedChunk.Value );
+
+		if ( NewLODIndex != LoadedChunk.Value.LODIndex )
+		{
+			LoadedChunk.Value.LODIndex = NewLODIndex;
+
+			PendingLODChunkList.Add ( LoadedChunk.Key );
+		}
+	}
+}
+
+int32 ULPPChunkManagerSubsystem::ComputeChunkLOD ( const FIntVector& ChunkID , const FLPPLoadedChunkData& LoadedChunk ) const
+{
+	const float LoaderDistance = GetNearestLoaderDistance ( ChunkID , LoadedChunk );
+
+	if ( LoaderDistance < 0.0f )
+	{
+		return LoadedChunk.LODIndex == INDEX_NONE ? 0 : LoadedChunk.LODIndex;
+	}
+
+	// First assign has no history so no hysteresis is apply
+	const bool  bHasHistory = LoadedChunk.LODIndex != INDEX_NONE;
+	const float Hysteresis  = bHasHistory ? LODHysteresis : 0.0f;
+
+	int32 NewLODIndex = bHasHistory ? FMath::Clamp ( LoadedChunk.LODIndex , 0 , LODDistanceList.Num ( ) ) : 0;
+
+	// Move farther only when we pass the threshold by hysteresis amount
+	while ( NewLODIndex < LODDistanceList.Num ( ) && LoaderDistance >= LODDistanceList [ NewLODIndex ] + Hysteresis )
+	{
+		NewLODIndex += 1;
+	}
+
+	// Move nearer only when we are inside the threshold by hysteresis amount
+	while ( NewLODIndex > 0 && LoaderDistance < LODDistanceList [ NewLODIndex - 1 ] - Hysteresis )
+	{
+		NewLODIndex -= 1;
+	}
+
+	return NewLODIndex;
+}
+
+void ULPPChunkManagerSubsystem::UpdateStreamingSourceLocationCache ( )
+{
+	for ( auto& SourceLocationList : StreamingSourceLocationMap )
+	{
+		SourceLocationList.Value.Reset ( );
+	}
+
+	for ( const auto& StreamingSource : StreamingSourceMap )
+	{
+		if ( StreamingSource.Key.IsValid ( ) == false || StreamingSource.Value.CenterChunkID == FIntVector::NoneValue )
+		{
+			continue;
+		}
+
+		StreamingSourceLocationMap.FindOrAdd ( StreamingSource.Value.CenterChunkID.X ).Add ( StreamingSource.Key->GetActorLocation ( ) );
+	}
+}
+
+float ULPPChunkManagerSubsystem::GetNearestLoaderDistance ( const FIntVector& ChunkID , const FLPPLoadedChunkData& LoadedChunk ) const
+{
+	const FVector ChunkLocation = GetChunkLocation ( ChunkID.X , ChunkID.Y , ChunkID.Z );
+
+	float NearestDistanceSquared = -1.0f;
+
+	const auto CheckLoaderLocation = [&] ( const FVector& LoaderLocation )
+	{
+		const float DistanceSquared = FVector::DistSquared ( LoaderLocation , ChunkLocation );
+
+		if ( NearestDistanceSquared < 0.0f || DistanceSquared < NearestDistanceSquared )
+		{
+			NearestDistanceSquared = DistanceSquared;
+		}
+	};
+
+	const AActor* StreamingLoaderActor = GetStreamingLoaderActor ( );
+
+	for ( const TWeakObjectPtr < AActor >& LoaderActor : LoadedChunk.LoaderList )
+	{
+		if ( LoaderActor.IsValid ( ) == false )
+		{
+			continue;
+		}
+
+		// Chunk loaded by streaming source use the source location instead
+		if ( LoaderActor.Get ( ) == StreamingLoaderActor )
+		{
+			if ( const TArray < FVector >* SourceLocationList = StreamingSourceLocationMap.Find ( ChunkID.X ) ; SourceLocationList != nullptr )
+			{
+				for ( const FVector& SourceLocation : *SourceLocationList )
+				{
+					CheckLoaderLocation ( SourceLocation );
+				}
+			}
+
+			continue;
+		}
+
+		CheckLoaderLocation ( LoaderActor->GetActorLocation ( ) );
+	}
+
+	return NearestDistanceSquared < 0.0f ? -1.0f : FMath::Sqrt ( NearestDistanceSquared );
+}
+
 AActor* ULPPChunkManagerSubsystem::AllocateChunkActor ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex )
 {
 	if ( IsValid ( GetWorld ( ) ) == false )
@@ -3,6 +3,8 @@
 
 #include "Subsystem/LPPProceduralWorldTaskSubsystem.h"
 
+#include "GameFramework/PlayerController.h"
+
 void ULPPProceduralWorldTaskSubsystem::Initialize ( FSubsystemCollectionBase& Collection )
 {
 	Super::Initialize ( Collection );
@@ -28,6 +30,10 @@ void ULPPProceduralWorldTaskSubsystem::Tick ( float DeltaTime )
 		}
 		while ( LazyGameThreadJobQueue.IsEmpty ( ) == false && CurrentBudget > ( FDateTime::UtcNow ( ) - StartWorkTime ).GetTotalSeconds ( ) );
 	}
+
+	UpdateViewerCache ( );
+
+	DispatchRebuild ( CurrentBudget , StartWorkTime );
 }
 
 void ULPPProceduralWorldTaskSubsystem::Deinitialize ( )
@@ -43,6 +49,9 @@ void ULPPProceduralWorldTaskSubsystem::Deinitialize ( )
 
 	PendingJobs.Empty ( );
 	LazyGameThreadJobQueue.Empty ( );
+
+	RebuildQueue.Empty ( );
+	InFlightRebuildList.Empty ( );
 }
 
 TStatId ULPPProceduralWorldTaskSubsystem::GetStatId ( ) const
@@ -107,3 +116,160 @@ UE::Tasks::FTask ULPPProceduralWorldTaskSubsystem::LaunchJobInternal ( FProcedur
 	                           } ,
 	                           Priority );
 }
+
+void ULPPProceduralWorldTaskSubsystem::RequestRebuild ( USceneComponent* Component , const TFunction < TWeakPtr < FProceduralWorldComputeJob >  ( ) >& RebuildWork )
+{
+	check ( IsInGameThread ( ) ); // Must In Game Thread
+
+	if ( IsValid ( Component ) == false || bIsShuttingDown )
+	{
+		return;
+	}
+
+	RebuildQueue.Add ( Component , RebuildWork );
+}
+
+void ULPPProceduralWorldTaskSubsystem::CancelRebuild ( USceneComponent* Component )
+{
+	RebuildQueue.Remove ( Component );
+}
+
+void ULPPProceduralWorldTaskSubsystem::SetupRebuildQueue ( const int32 NewMaxConcurrentRebuild , const float NewViewConeAngle , const float NewOutOfViewPenalty )
+{
+	MaxConcurrentRebuild = FMath::Max ( NewMaxConcurrentRebuild , 1 );
+	ViewConeCos          = FMath::Cos ( FMath::DegreesToRadians ( FMath::Clamp ( NewViewConeAngle , 0.0f , 180.0f ) ) );
+	OutOfViewPenalty     = FMath::Max ( NewOutOfViewPenalty , 0.0f );
+}
+
+float ULPPProceduralWorldTaskSubsystem::GetNearestViewerDistance ( const FVector& Location ) const
+{
+	float NearestDistanceSquared = -1.0f;
+
+	for ( const FVector& ViewerLocation : ViewerLocationList )
+	{
+		const float DistanceSquared = FVector::DistSquared ( ViewerLocation , Location );
+
+		if ( NearestDistanceSquared < 0.0f || DistanceSquared < NearestDistanceSquared )
+		{
+			NearestDistanceSquared = DistanceSquared;
+		}
+	}
+
+	return NearestDistanceSquared < 0.0f ? -1.0f : FMath::Sqrt ( NearestDistanceSquared );
+}
+
+void ULPPProceduralWorldTaskSubsystem::UpdateViewerCache ( )
+{
+	ViewerLocationList.Reset ( );
+	ViewerDirectionList.Reset ( );
+
+	if ( IsValid ( GetWorld ( ) ) == false )
+	{
+		return;
+	}
+
+	// Server see every player controller, client only see the local one
+	for ( FConstPlayerControllerIterator PlayerIt = GetWorld ( )->GetPlayerControllerIterator ( ) ; PlayerIt ; ++PlayerIt )
+	{
+		if ( const APlayerController* PlayerController = PlayerIt->Get ( ) ; IsValid ( PlayerController ) && IsValid ( PlayerController->GetPawnOrSpectator ( ) ) )
+		{
+			FVector  ViewLocation;
+			FRotator ViewRotation;
+
+			PlayerController->GetPlayerViewPoint ( ViewLocation , ViewRotation );
+
+			ViewerLocationList.Add ( ViewLocation );
+			ViewerDirectionList.Add ( ViewRotation.Vector ( ) );
+		}
+	}
+}
+
+void ULPPProceduralWorldTaskSubsystem::DispatchRebuild ( const float CurrentBudget , const FDateTime& StartWorkTime )
+{
+	InFlightRebuildList.RemoveAllSwap ( [] ( const TWeakPtr < FProceduralWorldComputeJob >& Job )
+	{
+		const TSharedPtr < FProceduralWorldComputeJob > PinJob = Job.Pin ( );
+
+		return PinJob.IsValid ( ) == false || PinJob->bCancelled || PinJob->bHasCompleted;
+	} , EAllowShrinking::No );
+
+	if ( RebuildQueue.IsEmpty ( ) || InFlightRebuildList.Num ( ) >= MaxConcurrentRebuild || bIsShuttingDown )
+	{
+		return;
+	}
+
+	TArray < TPair < float , TWeakObjectPtr < USceneComponent > > > PriorityList;
+
+	PriorityList.Reserve ( RebuildQueue.Num ( ) );
+
+	for ( auto QueueIt = RebuildQueue.CreateIterator ( ) ; QueueIt ; ++QueueIt )
+	{
+		if ( QueueIt.Key ( ).IsValid ( ) == false )
+		{
+			QueueIt.RemoveCurrent ( );
+
+			continue;
+		}
+
+		PriorityList.Add ( TPair < float , TWeakObjectPtr < USceneComponent > > ( GetRebuildPriority ( QueueIt.Key ( )->GetComponentLocation ( ) ) , QueueIt.Key ( ) ) );
+	}
+
+	const auto PriorityPredicate = [] ( const TPair < float , TWeakObjectPtr < USceneComponent > >& A , const TPair < float , TWeakObjectPtr < USceneComponent > >& B )
+	{
+		return A.Key < B.Key;
+	};
+
+	// Only a few entry is dispatch per tick, heap give them without sorting the whole queue
+	PriorityList.Heapify ( PriorityPredicate );
+
+	while ( PriorityList.IsEmpty ( ) == false && InFlightRebuildList.Num ( ) < MaxConcurrentRebuild )
+	{
+		TFunction < TWeakPtr < FProceduralWorldComputeJob >  ( ) > RebuildWork;
+
+		TPair < float , TWeakObjectPtr < USceneComponent > > PriorityEntry;
+
+		PriorityList.HeapPop ( PriorityEntry , PriorityPredicate , EAllowShrinking::No );
+
+		// Work can request another rebuild, so remove it before running
+		if ( RebuildQueue.RemoveAndCopyValue ( PriorityEntry.Value , RebuildWork ) && RebuildWork )
+		{
+			// Work may give back a job that is still running from last rebuild
+			if ( const TWeakPtr < FProceduralWorldComputeJob > Job = RebuildWork ( ) ; Job.IsValid ( ) )
+			{
+				InFlightRebuildList.AddUnique ( Job );
+			}
+		}
+
+		if ( CurrentBudget <= ( FDateTime::UtcNow ( ) - StartWorkTime ).GetTotalSeconds ( ) )
+		{
+			break;
+		}
+	}
+}
+
+float ULPPProceduralWorldTaskSubsystem::GetRebuildPriority ( const FVector& Location ) const
+{
+	if ( ViewerLocationList.IsEmpty ( ) )
+	{
+		return 0.0f;
+	}
+
+	float BestPriority = TNumericLimits < float >::Max ( );
+
+	for ( int32 ViewerIndex = 0 ; ViewerIndex < ViewerLocationList.Num ( ) ; ++ViewerIndex )
+	{
+		const FVector ViewerOffset = Location - ViewerLocationList [ ViewerIndex ];
+		const float   Distance     = ViewerOffset.Size ( );
+
+		float Priority = Distance;
+
+		if ( Distance > UE_KINDA_SMALL_NUMBER && FVector::DotProduct ( ViewerOffset / Distance , ViewerDirectionList [ ViewerIndex ] ) < ViewConeCos )
+		{
+			Priority += OutOfViewPenalty;
+		}
+
+		BestPriority = FMath::Min ( BestPriority , Priority );
+	}
+
+	return BestPriority;
+}
@@ -31,6 +31,8 @@ protected:
 	// Called when the game starts
 	virtual void BeginPlay ( ) override;
 
+	virtual void EndPlay ( const EEndPlayReason::Type EndPlayReason ) override;
+
 public:
 
 	// Called every frame
@@ -123,4 +125,8 @@ protected:
 
 	UPROPERTY ( EditAnywhere , Category = "Setting" )
 	bool bIsolatedRegion = false;
+
+	/* Let chunk manager share load cube with other requester instead of loading chunk by this owner */
+	UPROPERTY ( EditAnywhere , Category = "Setting" )
+	bool bUseAggregatedStreaming = false;
 };
@@ -113,6 +113,9 @@ public:
 
 	void InitializeFromData ( );
 
+	/* Build one buffer set per material straight from the indexed stream */
+	void InitializeFromStream ( const FLPPDynamicMeshStreamData& StreamData );
+
 public:
 
 	virtual void GetDistanceFieldAtlasData ( const class FDistanceFieldVolumeData*& OutDistanceFieldData , float& SelfShadowBias ) const override;
@@ -5,6 +5,41 @@
 #include "CoreMinimal.h"
 #include "DynamicMesh/DynamicMesh3.h"
 
+/**
+ * Indexed vertex stream, position , normal and uv share the same index
+ * - Mesher can write this directly when no FDynamicMesh3 operation is needed
+ */
+struct LOHPROCEDURALPLUGIN_API FLPPDynamicMeshStreamData
+{
+	TArray < FVector3f > PositionList = TArray < FVector3f > ( );
+	TArray < FVector3f > NormalList   = TArray < FVector3f > ( );
+	TArray < FVector2f > UVList       = TArray < FVector2f > ( );
+
+	/* Three index per triangle */
+	TArray < uint32 > IndexList = TArray < uint32 > ( );
+
+	/* One material per triangle */
+	TArray < uint8 > MaterialList = TArray < uint8 > ( );
+
+public:
+
+	FORCEINLINE bool IsEmpty ( ) const { return IndexList.IsEmpty ( ); }
+
+	FORCEINLINE int32 TriangleCount ( ) const { return IndexList.Num ( ) / 3; }
+
+	void Reset ( );
+
+	SIZE_T GetByteCount ( ) const;
+
+	UE::Geometry::FAxisAlignedBox3d GetBounds ( ) const;
+
+	/* Vertex with the same position is share so topology operation work, non-manifold triangle get its own vertex */
+	void ToDynamicMesh ( UE::Geometry::FDynamicMesh3& OutMesh ) const;
+
+	/* Position and triangle only without weld, enough for distance field and other geometry query */
+	void AppendGeometryToDynamicMesh ( UE::Geometry::FDynamicMesh3& OutMesh ) const;
+};
+
 /**
  * 
  */
@@ -14,6 +49,7 @@ public:
 
 	FLPPDynamicMeshRenderData ( FLPPDynamicMeshRenderData&& Other ) noexcept : MaterialMapping ( MoveTemp ( Other.MaterialMapping ) ),
 	                                                                           MeshData ( MoveTemp ( Other.MeshData ) ),
+	                                                                           StreamData ( MoveTemp ( Other.StreamData ) ),
 	                                                                           LocalBounds ( MoveTemp ( Other.LocalBounds ) ),
 	                                                                           Bounds ( MoveTemp ( Other.Bounds ) ),
 	                                                                           bHasNaniteFallbackMesh ( Other.bHasNaniteFallbackMesh ),
@@ -59,6 +95,9 @@ public:
 
 	TPimplPtr < UE::Geometry::FDynamicMesh3 > MeshData = nullptr;
 
+	/* Set by stream mesher, MeshData is only build from it when GetDynamicMesh is call */
+	TPimplPtr < FLPPDynamicMeshStreamData > StreamData = nullptr;
+
 	TPimplPtr < Nanite::FResources > NaniteResourcesPtr = nullptr;
 
 	TSharedPtr < FCardRepresentationData > LumenCardData = nullptr;
@@ -84,6 +123,22 @@ private:
 
 	bool bIsInitialized = false;
 
+	FCriticalSection MeshDataLock;
+
+public:
+
+	bool HasStreamData ( ) const
+	{
+		return StreamData.IsValid ( ) && StreamData->IsEmpty ( ) == false;
+	}
+
+	int32 GetTriangleCount ( ) const;
+
+	UE::Geometry::FAxisAlignedBox3d GetMeshBounds ( ) const;
+
+	/* Return MeshData, build it from StreamData on first call if the mesh come from a stream */
+	const UE::Geometry::FDynamicMesh3& GetDynamicMesh ( );
+
 public:
 
 	bool IsInitialized ( ) const
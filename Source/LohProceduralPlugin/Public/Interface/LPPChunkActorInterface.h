@@ -17,6 +17,7 @@ class ULPPChunkActorInterface : public UInterface
  * Chunk Actor Interface
  * - The actor that implements this should not replicate
  * - Chunk manager subsystems spawned actors only
+ * - Component of the chunk actor that implements this also receive OnRequestChunkUpdate and OnLODChanged ( See ULPPChunkManagerSubsystem::SetupChunkComponentNotify )
  */
 class LOHPROCEDURALPLUGIN_API ILPPChunkActorInterface
 {
@@ -33,6 +34,7 @@ public:
 	};
 
 	// Only on owing client
+	// Send by chunk manager when LOD is setup ( See ULPPChunkManagerSubsystem::SetupChunkLOD ), 0 is the nearest
 	UFUNCTION ( BlueprintNativeEvent , Category=Default )
 	void OnLODChanged ( const int32 LODIndex );
 
@@ -40,6 +42,7 @@ public:
 	{
 	};
 
+	// Edge neighbour receive the cell next to the edited one, empty list mean the whole chunk
 	UFUNCTION ( BlueprintNativeEvent , Category=Default )
 	void OnRequestChunkUpdate ( const TArray < int32 >& DataIndexList , const bool bIsMetaUpdate );
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
 #include "LPPChunkManagerSubsystem.generated.h"
 
 class ULFPChunkedTagDataComponent;
@@ -25,6 +26,42 @@ public:
 
 	UPROPERTY ( Transient )
 	TArray < TWeakObjectPtr < AActor > > LoaderList = TArray < TWeakObjectPtr < AActor > > ( );
+
+	/* Still waiting in AsyncLoadChunk and not notify yet */
+	UPROPERTY ( Transient )
+	bool bIsPendingLoad = false;
+
+	/* Last LOD send to the chunk actor, INDEX_NONE when LOD is disabled */
+	UPROPERTY ( Transient )
+	int32 LODIndex = INDEX_NONE;
+
+	/* Chunk can never produce geometry so no actor is allocate, loader is still track */
+	UPROPERTY ( Transient )
+	bool bIsOccupancySkipped = false;
+};
+
+USTRUCT ( )
+struct FLPPChunkOccupancyData
+{
+	GENERATED_BODY ( )
+
+public:
+
+	/* No cell match the occupancy tag */
+	UPROPERTY ( Transient )
+	bool bIsEmpty = false;
+
+	/* Every cell match the occupancy tag */
+	UPROPERTY ( Transient )
+	bool bIsFull = false;
+
+	/* One bit per border direction ( 6 face , 12 edge , 8 corner ), set when every border cell in that direction is empty */
+	UPROPERTY ( Transient )
+	uint32 BorderEmptyMask = 0;
+
+	/* One bit per border direction ( 6 face , 12 edge , 8 corner ), set when every border cell in that direction is solid */
+	UPROPERTY ( Transient )
+	uint32 BorderFullMask = 0;
 };
 
 USTRUCT ( BlueprintType )
@@ -41,6 +78,45 @@ public:
 	bool bIsMetaUpdate = true;
 };
 
+USTRUCT ( )
+struct FLPPChunkStreamingSourceData
+{
+	GENERATED_BODY ( )
+
+public:
+
+	/* Center that is already apply to the chunk interest */
+	UPROPERTY ( Transient )
+	FIntVector CenterChunkID = FIntVector::NoneValue;
+
+	/* Center that will be apply on next tick */
+	UPROPERTY ( Transient )
+	FIntVector PendingCenterChunkID = FIntVector::NoneValue;
+
+	UPROPERTY ( Transient )
+	int32 LoadDistance = 0;
+
+	/* Chunk that leave the load cube is keep until it is farther than this */
+	UPROPERTY ( Transient )
+	int32 UnloadDistance = 0;
+};
+
+USTRUCT ( )
+struct FLPPChunkStreamingBucketData
+{
+	GENERATED_BODY ( )
+
+public:
+
+	/* How many source share the same center and distance */
+	UPROPERTY ( Transient )
+	int32 SourceCount = 0;
+
+	/* Chunk held by this bucket, include chunk that is keep by unload distance after the center move */
+	UPROPERTY ( Transient )
+	TSet < FIntVector > ChunkIDList = TSet < FIntVector > ( );
+};
+
 /**
  * 
  */
@@ -69,6 +145,32 @@ public:
 		const uint8                                         TargetFrame
 		);
 
+	/*
+	 * LOD Setting
+	 * - LOD index is how many distance in NewLODDistanceList the nearest loader has pass ( List is sorted )
+	 * - Chunk only switch LOD after moving NewLODHysteresis pass the threshold
+	 * - Empty list disable LOD
+	 */
+	UFUNCTION ( BlueprintCallable , Category = "Default" , meta=(AutoCreateRefTerm="NewLODDistanceList") )
+	void SetupChunkLOD ( const TArray < float >& NewLODDistanceList , const float NewLODHysteresis = 400.0f , const float NewLODUpdateInterval = 0.25f );
+
+	/*
+	 * Occupancy Setting
+	 * - Cell matching any tag in NewOccupancyTagList is solid ( Should hold every layer tag the chunk mesh use )
+	 * - Chunk that is empty or full and surround by the same border state is track without allocating an actor
+	 * - Empty list disable occupancy skipping
+	 */
+	UFUNCTION ( BlueprintCallable , Category = "Default" , meta=(AutoCreateRefTerm="NewOccupancyTagList") )
+	void SetupChunkOccupancy ( const FGameplayTagContainer& NewOccupancyTagList );
+
+	/*
+	 * Component Notify Setting
+	 * - Chunk actor component that implements ILPPChunkActorInterface also receive OnRequestChunkUpdate and OnLODChanged
+	 * - Off by default, chunk actor that already forward these to its component would rebuild twice
+	 */
+	UFUNCTION ( BlueprintCallable , Category = "Default" )
+	void SetupChunkComponentNotify ( const bool bNewNotifyChunkComponent );
+
 public:
 
 	UFUNCTION ( BlueprintCallable , Category = "Default" )
@@ -80,6 +182,10 @@ public:
 	UFUNCTION ( BlueprintPure , Category = "Default" )
 	ULFPChunkedGridPositionComponent* GetPositionComponent ( const int32 ComponentIndex ) const;
 
+	/* Return true if the chunk is loaded but skipped by occupancy */
+	UFUNCTION ( BlueprintPure , Category = "Default" )
+	bool IsChunkOccupancySkipped ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex ) const;
+
 public:
 
 	UFUNCTION ( BlueprintCallable , Category = "Default" )
@@ -93,6 +199,37 @@ public:
 	UFUNCTION ( BlueprintCallable , Category = "Default" )
 	bool UnloadChunk ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex , AActor* LoaderActor );
 
+public:
+
+	/* Load a batch of chunk ID ( ComponentIndex , RegionIndex , ChunkIndex ) with a single validation pass */
+	void LoadChunkList ( TConstArrayView < FIntVector > ChunkIDList , AActor* LoaderActor );
+
+	/* Unload a batch of chunk ID ( ComponentIndex , RegionIndex , ChunkIndex ) with a single validation pass */
+	void UnloadChunkList ( TConstArrayView < FIntVector > ChunkIDList , AActor* LoaderActor );
+
+	UFUNCTION ( BlueprintCallable , Category = "Default" , meta=(DisplayName="Load Chunk List") )
+	void K2_LoadChunkList ( const TArray < FIntVector >& ChunkIDList , AActor* LoaderActor );
+
+	UFUNCTION ( BlueprintCallable , Category = "Default" , meta=(DisplayName="Unload Chunk List") )
+	void K2_UnloadChunkList ( const TArray < FIntVector >& ChunkIDList , AActor* LoaderActor );
+
+public:
+
+	/*
+	 * Streaming Source
+	 * - Source with the same center and distance share one bucket, so overlapping player only cost one load cube
+	 * - Change is apply once per tick and only the chunk that enter or leave the union are load or unload
+	 * - Moving bucket only visit the slab that enter the load cube or leave the unload cube
+	 */
+	UFUNCTION ( BlueprintCallable , Category = "Default" )
+	void RegisterStreamingSource ( AActor* SourceActor , const int32 LoadDistance , const int32 UnloadDistance );
+
+	UFUNCTION ( BlueprintCallable , Category = "Default" )
+	void UnregisterStreamingSource ( AActor* SourceActor );
+
+	UFUNCTION ( BlueprintCallable , Category = "Default" )
+	void UpdateStreamingSource ( AActor* SourceActor , const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex );
+
 public:
 
 	UFUNCTION ( BlueprintCallable , meta=(AutoCreateRefTerm="GridDataIndexList") , Category = "Default" )
@@ -109,6 +246,78 @@ protected:
 	UFUNCTION ( )
 	void NotifyChunkUpdate ( const int32 ComponentIndex , const int32 RegionIndex , const int32 ChunkIndex , const FLPPAsyncChunkManagerAction& ActionData ) const;
 
+	UFUNCTION ( )
+	void NotifyChunkLODChanged ( const FIntVector& ChunkID , const int32 LODIndex ) const;
+
+protected:
+
+	/* Recompute LOD for every loaded chunk and queue the changed one */
+	void UpdateChunkLOD ( );
+
+	int32 ComputeChunkLOD ( const FIntVector& ChunkID , const FLPPLoadedChunkData& LoadedChunk ) const;
+
+	/* Collect streaming source location once per tick so LOD don't walk every source per chunk */
+	void UpdateStreamingSourceLocationCache ( );
+
+	/* Return -1 if no loader is valid */
+	float GetNearestLoaderDistance ( const FIntVector& ChunkID , const FLPPLoadedChunkData& LoadedChunk ) const;
+
+protected:
+
+	/* Return cached occupancy of the chunk, compute it if the cache is missing or invalidated */
+	const FLPPChunkOccupancyData& GetChunkOccupancy ( const FIntVector& ChunkID );
+
+	/* Return true if the chunk and the border of every neighbour it sample are in the same empty or full state */
+	bool CanSkipChunkByOccupancy ( const FIntVector& ChunkID );
+
+	/* Allocate actor for a skipped chunk that can produce geometry again */
+	void RefreshOccupancySkippedChunk ( const FIntVector& ChunkID );
+
+	/* Drop cached occupancy of an unloaded chunk and its neighbour that is not loaded, cache only hold loaded chunk and their border */
+	void EvictChunkOccupancy ( const FIntVector& ChunkID );
+
+	/* Bit index of a border direction in FLPPChunkOccupancyData mask, opposite direction is 26 - Index */
+	static int32 ToBorderDirectionIndex ( const FIntVector& Direction );
+
+protected:
+
+	/* Apply all the streaming source that move since last tick */
+	void ApplyStreamingSourceChange ( );
+
+	/* Stream Distance : X is load distance , Y is unload distance */
+	void MoveSourceToBucket ( const FIntVector& OldCenterChunkID , const FIntVector& NewCenterChunkID , const FIntPoint& StreamDistance );
+
+	void RemoveSourceFromBucket ( const FIntVector& CenterChunkID , const FIntPoint& StreamDistance );
+
+	/* Hold every chunk in the load cube, offset inside the exclude box is skip because it is already held */
+	void HoldBucketChunk ( FLPPChunkStreamingBucketData& BucketData , const FIntVector& CenterChunkID , const int32 LoadDistance , const FIntVector& ExcludeMin , const FIntVector& ExcludeMax );
+
+	/* Release held chunk in the old unload cube that is outside the exclude box */
+	void ReleaseBucketChunk ( FLPPChunkStreamingBucketData& BucketData , const FIntVector& OldCenterChunkID , const int32 UnloadDistance , const FIntVector& ExcludeMin , const FIntVector& ExcludeMax );
+
+	/* Return false if the move can't be express as a chunk offset that overlap the old cube */
+	bool GetStreamingMoveOffset ( const FIntVector& OldCenterChunkID , const FIntVector& NewCenterChunkID , const int32 MaxOffset , FIntVector& OutMoveOffset ) const;
+
+	void IncreaseChunkInterest ( const FIntVector& ChunkID );
+
+	void DecreaseChunkInterest ( const FIntVector& ChunkID );
+
+	/* Actor that own every chunk loaded by streaming source */
+	AActor* GetStreamingLoaderActor ( ) const;
+
+	UFUNCTION ( )
+	void OnStreamingSourceDestroyed ( AActor* DestroyedActor );
+
+protected:
+
+	/* Caller must already validate world, loader, chunk actor class and component index */
+	AActor* LoadChunk_Internal ( const FIntVector& ChunkID , AActor* LoaderActor );
+
+	/* Caller must already validate world and loader, return true if loader is removed from the chunk */
+	bool UnloadChunk_Internal ( const FIntVector& ChunkID , AActor* LoaderActor , TSet < FIntVector >* PendingLoadRemoveList = nullptr );
+
+	bool CanLoadChunk ( AActor* LoaderActor ) const;
+
 protected:
 
 	UFUNCTION ( )
@@ -145,6 +354,30 @@ protected:
 	UPROPERTY ( Transient )
 	FVector SpawnOffset = FVector ( 0.0f , 0.0f , 0.0f );
 
+protected:
+
+	UPROPERTY ( Transient )
+	TArray < float > LODDistanceList = TArray < float > ( );
+
+	UPROPERTY ( Transient )
+	float LODHysteresis = 0.0f;
+
+	UPROPERTY ( Transient )
+	float LODUpdateInterval = 0.25f;
+
+	UPROPERTY ( Transient )
+	float LODUpdateTimer = 0.0f;
+
+protected:
+
+	UPROPERTY ( Transient )
+	FGameplayTagContainer OccupancyTagList = FGameplayTagContainer ( );
+
+protected:
+
+	UPROPERTY ( Transient )
+	bool bNotifyChunkComponent = false;
+
 private:
 
 	UPROPERTY ( Transient )
@@ -152,4 +385,34 @@ private:
 
 	UPROPERTY ( Transient )
 	TMap < FIntVector , FLPPAsyncChunkManagerAction > BatchUpdateList = TMap < FIntVector , FLPPAsyncChunkManagerAction > ( );
+
+	UPROPERTY ( Transient )
+	TSet < FIntVector > PendingLODChunkList = TSet < FIntVector > ( );
+
+	UPROPERTY ( Transient )
+	TMap < FIntVector , FLPPChunkOccupancyData > ChunkOccupancyMap = TMap < FIntVector , FLPPChunkOccupancyData > ( );
+
+private:
+
+	UPROPERTY ( Transient )
+	TMap < TWeakObjectPtr < AActor > , FLPPChunkStreamingSourceData > StreamingSourceMap = TMap < TWeakObjectPtr < AActor > , FLPPChunkStreamingSourceData > ( );
+
+	UPROPERTY ( Transient )
+	TSet < TWeakObjectPtr < AActor > > DirtyStreamingSourceList = TSet < TWeakObjectPtr < AActor > > ( );
+
+	/* Key : Component Index , Value : Streaming source location of that component , refresh by UpdateStreamingSourceLocationCache */
+	TMap < int32 , TArray < FVector > > StreamingSourceLocationMap = TMap < int32 , TArray < FVector > > ( );
+
+	/* Key : Center Chunk ID + ( Load Distance , Unload Distance ) */
+	TMap < TPair < FIntVector , FIntPoint > , FLPPChunkStreamingBucketData > StreamingBucketMap = TMap < TPair < FIntVector , FIntPoint > , FLPPChunkStreamingBucketData > ( );
+
+	/* How many bucket want this chunk */
+	UPROPERTY ( Transient )
+	TMap < FIntVector , int32 > ChunkInterestCountMap = TMap < FIntVector , int32 > ( );
+
+	UPROPERTY ( Transient )
+	TSet < FIntVector > PendingStreamLoadList = TSet < FIntVector > ( );
+
+	UPROPERTY ( Transient )
+	TSet < FIntVector > PendingStreamUnloadList = TSet < FIntVector > ( );
 };
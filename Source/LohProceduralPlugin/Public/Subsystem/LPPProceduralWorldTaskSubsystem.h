@@ -47,6 +47,39 @@ public:
 		const bool                                                                                                                      bSingleThreadMode = false
 		);
 
+public:
+
+	/*
+	 * Rebuild Queue
+	 * - Request for the same component is merge, the last work is keep
+	 * - Work return the launched job so it count toward MaxConcurrentRebuild until it is done
+	 */
+	void RequestRebuild ( USceneComponent* Component , const TFunction < TWeakPtr < FProceduralWorldComputeJob >  ( ) >& RebuildWork );
+
+	void CancelRebuild ( USceneComponent* Component );
+
+	/*
+	 * Rebuild Queue Setting
+	 * - Nearest chunk to any viewer is rebuild first
+	 * - Chunk outside NewViewConeAngle ( Degree ) of every viewer get NewOutOfViewPenalty added to its distance
+	 */
+	UFUNCTION ( BlueprintCallable , Category = "Default" )
+	void SetupRebuildQueue ( const int32 NewMaxConcurrentRebuild = 4 , const float NewViewConeAngle = 60.0f , const float NewOutOfViewPenalty = 3200.0f );
+
+	/* Return -1 if there is no viewer */
+	UFUNCTION ( BlueprintPure , Category = "Default" )
+	float GetNearestViewerDistance ( const FVector& Location ) const;
+
+protected:
+
+	/* Cache every player view point once per tick so rebuild request don't iterate player */
+	void UpdateViewerCache ( );
+
+	void DispatchRebuild ( const float CurrentBudget , const FDateTime& StartWorkTime );
+
+	/* Lower is rebuild first */
+	float GetRebuildPriority ( const FVector& Location ) const;
+
 protected:
 
 	FORCEINLINE UE::Tasks::FTask LaunchJobInternal ( FProceduralWorldComputeJob* JobPtr , const LowLevelTasks::ETaskPriority Priority = LowLevelTasks::ETaskPriority::BackgroundHigh );
@@ -65,6 +98,29 @@ protected:
 
 	UPROPERTY ( Transient )
 	float TickBudget = 0.0f;
+
+protected:
+
+	UPROPERTY ( Transient )
+	TArray < FVector > ViewerLocationList = TArray < FVector > ( );
+
+	UPROPERTY ( Transient )
+	TArray < FVector > ViewerDirectionList = TArray < FVector > ( );
+
+	UPROPERTY ( Transient )
+	int32 MaxConcurrentRebuild = 4;
+
+	UPROPERTY ( Transient )
+	float ViewConeCos = 0.5f;
+
+	UPROPERTY ( Transient )
+	float OutOfViewPenalty = 3200.0f;
+
+private:
+
+	TMap < TWeakObjectPtr < USceneComponent > , TFunction < TWeakPtr < FProceduralWorldComputeJob >  ( ) > > RebuildQueue;
+
+	TArray < TWeakPtr < FProceduralWorldComputeJob > > InFlightRebuildList;
 };
 
 struct TAsyncProceduralWorldTask
@@ -5,26 +5,1332 @@
 
 #include "Components/LPPMarchingMeshComponent.h"
 
-#include "DynamicMeshEditor.h"
-#include "MeshAdapterTransforms.h"
+#include "Async/ParallelFor.h"
+#include "CompGeom/PolygonTriangulation.h"
 #include "MeshCardBuild.h"
 #include "MeshSimplification.h"
 #include "Components/LFPChunkedGridPositionComponent.h"
 #include "Components/LFPChunkedTagDataComponent.h"
 #include "Data/LPPDynamicMeshRenderData.h"
 #include "Data/LPPMarchingData.h"
-#include "DynamicMesh/MeshNormals.h"
-#include "DynamicMesh/Operations/MergeCoincidentMeshEdges.h"
 #include "Library/LPPDynamicMeshLibrary.h"
 #include "Library/LPPMarchingFunctionLibrary.h"
 #include "Math/LFPGridLibrary.h"
-#include "Operations/MeshPlaneCut.h"
-#include "Parameterization/DynamicMeshUVEditor.h"
 #include "Render/LFPRenderLibrary.h"
 #include "Windows/WindowsHWrapper.h"
 
 LLM_DEFINE_TAG ( LFPMarchingMesh );
 
+namespace LPPMarchingStreamMesher
+{
+	/* Tile meet on cell face at quantizable position, so snap to a fixed point lattice instead of a spatial search */
+	FORCEINLINE FIntVector ToLatticeKey ( const FVector3f& Position , const float InvWeldDistance )
+	{
+		return FIntVector ( FMath::RoundToInt ( Position.X * InvWeldDistance ) , FMath::RoundToInt ( Position.Y * InvWeldDistance ) , FMath::RoundToInt ( Position.Z * InvWeldDistance ) );
+	}
+
+	struct FClipVertex
+	{
+		FVector3f Position = FVector3f::ZeroVector;
+		FVector3f Normal   = FVector3f::UpVector;
+		FVector2f UV       = FVector2f::ZeroVector;
+
+		/* Normal is bake on the tile bound face */
+		bool bIsBorder = false;
+
+		static FClipVertex Lerp ( const FClipVertex& A , const FClipVertex& B , const float Alpha )
+		{
+			FClipVertex Result;
+
+			Result.Position = FMath::Lerp ( A.Position , B.Position , Alpha );
+			Result.Normal   = FMath::Lerp ( A.Normal , B.Normal , Alpha ).GetSafeNormal ( );
+			Result.UV       = FMath::Lerp ( A.UV , B.UV , Alpha );
+
+			Result.bIsBorder = A.bIsBorder && B.bIsBorder;
+
+			return Result;
+		}
+	};
+
+	/* Vertex is weld by lattice position, normal and uv must match exactly so hard edge is keep */
+	struct FStreamVertexKey
+	{
+		FIntVector Lattice = FIntVector::ZeroValue;
+		FVector3f  Normal  = FVector3f::ZeroVector;
+		FVector2f  UV      = FVector2f::ZeroVector;
+
+		FORCEINLINE bool operator== ( const FStreamVertexKey& Other ) const
+		{
+			return Lattice == Other.Lattice && Normal == Other.Normal && UV == Other.UV;
+		}
+
+		FORCEINLINE friend uint32 GetTypeHash ( const FStreamVertexKey& Key )
+		{
+			return HashCombineFast ( GetTypeHash ( Key.Lattice ) , HashCombineFast ( GetTypeHash ( Key.Normal ) , GetTypeHash ( Key.UV ) ) );
+		}
+	};
+
+	class FStreamWriter
+	{
+	public:
+
+		FStreamWriter ( FLPPMarchingStreamBlock& InBlock , const float WeldDistance ) : Block ( InBlock ),
+		                                                                               InvWeldDistance ( 1.0f / FMath::Max ( WeldDistance , UE_KINDA_SMALL_NUMBER ) )
+		{
+			Block.StreamData.Reset ( );
+			Block.SeamList.Reset ( );
+			Block.BorderList.Reset ( );
+		}
+
+		/* Set by caller for cell on the block outer layer */
+		bool bIsSeam = false;
+
+		uint32 AddVertex ( const FClipVertex& Vertex )
+		{
+			const FStreamVertexKey VertexKey = { ToLatticeKey ( Vertex.Position , InvWeldDistance ) , Vertex.Normal , Vertex.UV };
+
+			if ( const uint32* VertexIndexPtr = VertexMap.Find ( VertexKey ) ; VertexIndexPtr != nullptr )
+			{
+				Block.SeamList [ *VertexIndexPtr ] |= bIsSeam;
+
+				return *VertexIndexPtr;
+			}
+
+			const uint32 VertexIndex = Block.StreamData.PositionList.Add ( Vertex.Position );
+
+			Block.StreamData.NormalList.Add ( Vertex.Normal );
+			Block.StreamData.UVList.Add ( Vertex.UV );
+
+			Block.SeamList.Add ( bIsSeam );
+			Block.BorderList.Add ( Vertex.bIsBorder );
+
+			VertexMap.Add ( VertexKey , VertexIndex );
+
+			return VertexIndex;
+		}
+
+		/* Fan triangulate a convex polygon, triangle collapse by welding is drop */
+		void AddPolygon ( const TArray < FClipVertex >& Polygon , const uint8 MaterialID )
+		{
+			if ( Polygon.Num ( ) < 3 )
+			{
+				return;
+			}
+
+			FLPPDynamicMeshStreamData& StreamData = Block.StreamData;
+
+			const uint32 RootIndex = AddVertex ( Polygon [ 0 ] );
+
+			uint32 LastIndex = AddVertex ( Polygon [ 1 ] );
+
+			for ( int32 PolygonIndex = 2 ; PolygonIndex < Polygon.Num ( ) ; ++PolygonIndex )
+			{
+				const uint32 NextIndex = AddVertex ( Polygon [ PolygonIndex ] );
+
+				if ( RootIndex != LastIndex && LastIndex != NextIndex && NextIndex != RootIndex )
+				{
+					StreamData.IndexList.Add ( RootIndex );
+					StreamData.IndexList.Add ( LastIndex );
+					StreamData.IndexList.Add ( NextIndex );
+					StreamData.MaterialList.Add ( MaterialID );
+				}
+
+				LastIndex = NextIndex;
+			}
+		}
+
+	private:
+
+		FLPPMarchingStreamBlock& Block;
+
+		const float InvWeldDistance;
+
+		TMap < FStreamVertexKey , uint32 > VertexMap;
+	};
+
+	/* Splice block in index order so output is deterministic, only seam vertex go through the weld map */
+	static void MergeBlockList ( FLPPDynamicMeshStreamData& Target , TBitArray < >& TargetBorderList , const TArray < FLPPMarchingStreamBlock >& BlockList , const float WeldDistance )
+	{
+		const float InvWeldDistance = 1.0f / FMath::Max ( WeldDistance , UE_KINDA_SMALL_NUMBER );
+
+		Target.Reset ( );
+		TargetBorderList.Reset ( );
+
+		// Final size is know up front so the output never grow
+		{
+			int32 VertexCount   = 0;
+			int32 TriangleCount = 0;
+
+			for ( const FLPPMarchingStreamBlock& Block : BlockList )
+			{
+				VertexCount += Block.StreamData.PositionList.Num ( );
+				TriangleCount += Block.StreamData.MaterialList.Num ( );
+			}
+
+			Target.PositionList.Reserve ( VertexCount );
+			Target.NormalList.Reserve ( VertexCount );
+			Target.UVList.Reserve ( VertexCount );
+			Target.IndexList.Reserve ( TriangleCount * 3 );
+			Target.MaterialList.Reserve ( TriangleCount );
+		}
+
+		TMap < FStreamVertexKey , uint32 > SeamMap;
+
+		TArray < uint32 > RemapList;
+
+		for ( const FLPPMarchingStreamBlock& Block : BlockList )
+		{
+			const FLPPDynamicMeshStreamData& BlockData = Block.StreamData;
+
+			RemapList.SetNumUninitialized ( BlockData.PositionList.Num ( ) , EAllowShrinking::No );
+
+			for ( int32 VertexIndex = 0 ; VertexIndex < BlockData.PositionList.Num ( ) ; ++VertexIndex )
+			{
+				const FVector3f& Position = BlockData.PositionList [ VertexIndex ];
+				const FVector3f& Normal   = BlockData.NormalList [ VertexIndex ];
+				const FVector2f& UV       = BlockData.UVList [ VertexIndex ];
+
+				uint32* SeamIndexPtr = nullptr;
+
+				if ( Block.SeamList [ VertexIndex ] )
+				{
+					const FStreamVertexKey VertexKey = { ToLatticeKey ( Position , InvWeldDistance ) , Normal , UV };
+
+					SeamIndexPtr = &SeamMap.FindOrAdd ( VertexKey , MAX_uint32 );
+
+					if ( *SeamIndexPtr != MAX_uint32 )
+					{
+						RemapList [ VertexIndex ] = *SeamIndexPtr;
+
+						continue;
+					}
+				}
+
+				RemapList [ VertexIndex ] = Target.PositionList.Add ( Position );
+
+				Target.NormalList.Add ( Normal );
+				Target.UVList.Add ( UV );
+
+				TargetBorderList.Add ( Block.BorderList [ VertexIndex ] );
+
+				if ( SeamIndexPtr != nullptr )
+				{
+					*SeamIndexPtr = RemapList [ VertexIndex ];
+				}
+			}
+
+			for ( const uint32 Index : BlockData.IndexList )
+			{
+				Target.IndexList.Add ( RemapList [ Index ] );
+			}
+
+			Target.MaterialList.Append ( BlockData.MaterialList );
+		}
+	}
+
+	/* Average border normal of tile meeting on the same lattice point, normal past the angle keep the hard edge */
+	static void SmoothBorderNormal ( FLPPDynamicMeshStreamData& Target , const TBitArray < >& BorderList , const float WeldDistance , const float SmoothAngle )
+	{
+		const float InvWeldDistance = 1.0f / FMath::Max ( WeldDistance , UE_KINDA_SMALL_NUMBER );
+		const float MinDot          = FMath::Cos ( FMath::DegreesToRadians ( SmoothAngle ) );
+
+		TMap < FIntVector , TArray < int32 , TInlineAllocator < 8 > > > BorderMap;
+
+		for ( TConstSetBitIterator < > BorderIt ( BorderList ) ; BorderIt ; ++BorderIt )
+		{
+			BorderMap.FindOrAdd ( ToLatticeKey ( Target.PositionList [ BorderIt.GetIndex ( ) ] , InvWeldDistance ) ).Add ( BorderIt.GetIndex ( ) );
+		}
+
+		TArray < FVector3f , TInlineAllocator < 8 > > SmoothList;
+
+		for ( const auto& BorderGroup : BorderMap )
+		{
+			const TArray < int32 , TInlineAllocator < 8 > >& VertexList = BorderGroup.Value;
+
+			if ( VertexList.Num ( ) < 2 )
+			{
+				continue;
+			}
+
+			// Read every source normal before any write so the result is not order dependent
+			SmoothList.Reset ( );
+
+			for ( const int32 VertexIndex : VertexList )
+			{
+				const FVector3f& Normal = Target.NormalList [ VertexIndex ];
+
+				FVector3f NormalSum = FVector3f::ZeroVector;
+
+				for ( const int32 OtherIndex : VertexList )
+				{
+					if ( ( Normal | Target.NormalList [ OtherIndex ] ) >= MinDot )
+					{
+						NormalSum += Target.NormalList [ OtherIndex ];
+					}
+				}
+
+				SmoothList.Add ( NormalSum.GetSafeNormal ( UE_SMALL_NUMBER , Normal ) );
+			}
+
+			for ( int32 Index = 0 ; Index < VertexList.Num ( ) ; ++Index )
+			{
+				Target.NormalList [ VertexList [ Index ] ] = SmoothList [ Index ];
+			}
+		}
+	}
+
+	/* Shared normal element of a welded vertex, seed normal decide which tile normal may join */
+	struct FBorderNormalElement
+	{
+		int32     ElementID = INDEX_NONE;
+		FVector3f Normal    = FVector3f::UpVector;
+		FVector3f NormalSum = FVector3f::ZeroVector;
+	};
+
+	/* Fill polygon with one baked tile triangle scale by LOD step and move to the cell location */
+	static void BuildTilePolygon ( TArray < FClipVertex >& Polygon , const FLPPMarchingBakedTile& BakedTile , const int32 TriangleIndex , const FVector3f& Offset , const float Scale )
+	{
+		Polygon.Reset ( );
+
+		for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+		{
+			FClipVertex& ClipVertex = Polygon.AddDefaulted_GetRef ( );
+
+			const int32 NormalIndex = BakedTile.TriangleNormalList [ TriangleIndex ] [ Corner ];
+			const int32 UVIndex     = BakedTile.TriangleUVList [ TriangleIndex ] [ Corner ];
+
+			ClipVertex.Position = ( BakedTile.PositionList [ BakedTile.TriangleList [ TriangleIndex ] [ Corner ] ] * Scale ) + Offset;
+			ClipVertex.Normal   = NormalIndex != INDEX_NONE ? BakedTile.NormalList [ NormalIndex ] : FVector3f::UpVector;
+			ClipVertex.UV       = UVIndex != INDEX_NONE ? BakedTile.UVList [ UVIndex ] : FVector2f::ZeroVector;
+
+			ClipVertex.bIsBorder = NormalIndex != INDEX_NONE && BakedTile.BorderNormalList [ NormalIndex ];
+		}
+	}
+
+	/* Sutherland-Hodgman clip against the chunk box, keep the inside part */
+	static void ClipPolygonByBox ( TArray < FClipVertex >& Polygon , TArray < FClipVertex >& Scratch , const FVector3f& BoxHalfSize )
+	{
+		for ( int32 PlaneIndex = 0 ; PlaneIndex < 6 && Polygon.Num ( ) >= 3 ; ++PlaneIndex )
+		{
+			const int32 Axis = PlaneIndex % 3;
+			const float Sign = PlaneIndex < 3 ? 1.0f : -1.0f;
+
+			// Positive is outside
+			const auto GetDistance = [&] ( const FClipVertex& Vertex ) { return Vertex.Position [ Axis ] * Sign - BoxHalfSize [ Axis ]; };
+
+			Scratch.Reset ( );
+
+			for ( int32 EdgeIndex = 0 ; EdgeIndex < Polygon.Num ( ) ; ++EdgeIndex )
+			{
+				const FClipVertex& Current = Polygon [ EdgeIndex ];
+				const FClipVertex& Next    = Polygon [ ( EdgeIndex + 1 ) % Polygon.Num ( ) ];
+
+				const float CurrentDistance = GetDistance ( Current );
+				const float NextDistance    = GetDistance ( Next );
+
+				if ( CurrentDistance <= 0.0f )
+				{
+					Scratch.Add ( Current );
+				}
+
+				if ( ( CurrentDistance <= 0.0f ) != ( NextDistance <= 0.0f ) )
+				{
+					Scratch.Add ( FClipVertex::Lerp ( Current , Next , CurrentDistance / ( CurrentDistance - NextDistance ) ) );
+				}
+			}
+
+			Swap ( Polygon , Scratch );
+		}
+	}
+
+	/* Box projection by face main axis, same mapping as the uv editor box projection but without island pass */
+	struct FBoxUVProjector
+	{
+		explicit FBoxUVProjector ( const FTransform& Transform ) : Rotation ( FQuat4f ( Transform.GetRotation ( ) ) ),
+		                                                          Origin ( FVector3f ( Transform.GetLocation ( ) ) )
+		{
+			const FVector3f Scale = FVector3f ( Transform.GetScale3D ( ) );
+
+			for ( int32 Axis = 0 ; Axis < 3 ; ++Axis )
+			{
+				InvScale [ Axis ] = FMath::Abs ( Scale [ Axis ] ) > UE_SMALL_NUMBER ? 1.0f / Scale [ Axis ] : 1.0f;
+			}
+		}
+
+		/* Main axis times two plus one when facing negative */
+		FORCEINLINE int32 GetFaceIndex ( const FVector3f& FaceNormal ) const
+		{
+			const FVector3f LocalNormal = Rotation.UnrotateVector ( FaceNormal );
+			const FVector3f AbsNormal   = LocalNormal.GetAbs ( );
+			const int32     MainAxis    = AbsNormal.X >= AbsNormal.Y ? ( AbsNormal.X >= AbsNormal.Z ? 0 : 2 ) : ( AbsNormal.Y >= AbsNormal.Z ? 1 : 2 );
+
+			return ( MainAxis * 2 ) + ( LocalNormal [ MainAxis ] < 0.0f ? 1 : 0 );
+		}
+
+		FORCEINLINE FVector2f GetUV ( const FVector3f& Position , const int32 FaceIndex ) const
+		{
+			const FVector3f LocalPosition = Rotation.UnrotateVector ( Position - Origin ) * InvScale;
+			const float     Sign          = ( FaceIndex & 1 ) != 0 ? -1.0f : 1.0f;
+
+			switch ( FaceIndex / 2 )
+			{
+			case 0 : return FVector2f ( LocalPosition.Y * Sign , -LocalPosition.Z );
+			case 1 : return FVector2f ( -LocalPosition.X * Sign , -LocalPosition.Z );
+			default : return FVector2f ( LocalPosition.X * Sign , LocalPosition.Y );
+			}
+		}
+
+		void SetPolygonUV ( TArray < FClipVertex >& Polygon , const int32 FaceIndex ) const
+		{
+			for ( FClipVertex& Vertex : Polygon )
+			{
+				Vertex.UV = GetUV ( Vertex.Position , FaceIndex );
+			}
+		}
+
+	private:
+
+		FQuat4f   Rotation = FQuat4f::Identity;
+		FVector3f Origin   = FVector3f::ZeroVector;
+		FVector3f InvScale = FVector3f::OneVector;
+	};
+
+	/* Surface nets vertex of one marching id, offset is in cell unit around the cell center */
+	struct FSurfaceNetsEntry
+	{
+		FVector3f Offset = FVector3f::ZeroVector;
+		FVector3f Normal = FVector3f::UpVector;
+	};
+
+	/* Average of the crossing edge midpoint and the corner gradient, build once for all 256 id */
+	static const TArray < FSurfaceNetsEntry >& GetSurfaceNetsTable ( )
+	{
+		static const TArray < FSurfaceNetsEntry > SurfaceNetsTable = [] ( )
+		{
+			TArray < FSurfaceNetsEntry > NewTable;
+
+			NewTable.SetNum ( 256 );
+
+			for ( int32 MarchingID = 1 ; MarchingID < 255 ; ++MarchingID )
+			{
+				FVector3f EdgeSum   = FVector3f::ZeroVector;
+				int32     EdgeCount = 0;
+				FVector3f Gradient  = FVector3f::ZeroVector;
+
+				for ( int32 CornerIndex = 0 ; CornerIndex < 8 ; ++CornerIndex )
+				{
+					const FVector3f CornerOffset = FVector3f ( ( CornerIndex & 1 ) - 0.5f , ( ( CornerIndex >> 1 ) & 1 ) - 0.5f , ( CornerIndex >> 2 ) - 0.5f );
+					const bool      bIsSolid     = ( ( MarchingID >> CornerIndex ) & 1 ) != 0;
+
+					// Point from solid to empty
+					Gradient += bIsSolid ? -CornerOffset : CornerOffset;
+
+					for ( int32 Axis = 0 ; Axis < 3 ; ++Axis )
+					{
+						const int32 OtherIndex = CornerIndex | ( 1 << Axis );
+
+						if ( OtherIndex == CornerIndex || bIsSolid == ( ( ( MarchingID >> OtherIndex ) & 1 ) != 0 ) )
+						{
+							continue;
+						}
+
+						FVector3f EdgeMidpoint = CornerOffset;
+
+						EdgeMidpoint [ Axis ] = 0.0f;
+
+						EdgeSum += EdgeMidpoint;
+						EdgeCount += 1;
+					}
+				}
+
+				NewTable [ MarchingID ].Offset = EdgeSum / FMath::Max ( EdgeCount , 1 );
+				NewTable [ MarchingID ].Normal = Gradient.GetSafeNormal ( UE_SMALL_NUMBER , FVector3f::UpVector );
+			}
+
+			return NewTable;
+		} ( );
+
+		return SurfaceNetsTable;
+	}
+
+	/* One vertex per surface cell share by every quad around it, edge on the far chunk face is left to the neighbour chunk */
+	static void BuildSurfaceNets ( FLPPDynamicMeshStreamData& Target , TArray < int32 >& CellVertexList , const uint8* MarchingIDList , const FIntVector& MarchingSize , const FVector3f& CellSize , const FVector3f& BoundHalfSize , const uint8 MaterialID , const FBoxUVProjector* BoxUVProjector = nullptr )
+	{
+		const TArray < FSurfaceNetsEntry >& SurfaceNetsTable = GetSurfaceNetsTable ( );
+
+		CellVertexList.Init ( INDEX_NONE , MarchingSize.X * MarchingSize.Y * MarchingSize.Z );
+
+		const auto GetCellVertex = [&] ( const FIntVector& CellLocation ) -> uint32
+		{
+			const int32 CellIndex = CellLocation.X + ( ( CellLocation.Y + ( CellLocation.Z * MarchingSize.Y ) ) * MarchingSize.X );
+
+			int32& VertexIndex = CellVertexList [ CellIndex ];
+
+			if ( VertexIndex == INDEX_NONE )
+			{
+				const FSurfaceNetsEntry& Entry = SurfaceNetsTable [ MarchingIDList [ CellIndex ] ];
+
+				const FVector3f Position = ( ( FVector3f ( CellLocation ) + Entry.Offset ) * CellSize ) - BoundHalfSize;
+
+				// Planar UV on the main normal axis in cell unit
+				const FVector3f AbsNormal = Entry.Normal.GetAbs ( );
+				const int32     MainAxis  = AbsNormal.X >= AbsNormal.Y ? ( AbsNormal.X >= AbsNormal.Z ? 0 : 2 ) : ( AbsNormal.Y >= AbsNormal.Z ? 1 : 2 );
+				const int32     UAxis     = ( MainAxis + 1 ) % 3;
+				const int32     VAxis     = ( MainAxis + 2 ) % 3;
+
+				VertexIndex = Target.PositionList.Add ( Position );
+
+				Target.NormalList.Add ( Entry.Normal );
+				Target.UVList.Add ( BoxUVProjector != nullptr ? BoxUVProjector->GetUV ( Position , BoxUVProjector->GetFaceIndex ( Entry.Normal ) ) : FVector2f ( Position [ UAxis ] / CellSize [ UAxis ] , Position [ VAxis ] / CellSize [ VAxis ] ) );
+			}
+
+			return static_cast < uint32 > ( VertexIndex );
+		};
+
+		const auto AddTriangle = [&] ( const uint32 A , const uint32 B , const uint32 C )
+		{
+			Target.IndexList.Add ( A );
+			Target.IndexList.Add ( B );
+			Target.IndexList.Add ( C );
+			Target.MaterialList.Add ( MaterialID );
+		};
+
+		int32 CellIndex = 0;
+
+		for ( int32 Z = 0 ; Z < MarchingSize.Z ; ++Z )
+		{
+			for ( int32 Y = 0 ; Y < MarchingSize.Y ; ++Y )
+			{
+				for ( int32 X = 0 ; X < MarchingSize.X ; ++X , ++CellIndex )
+				{
+					const uint8 MarchingID = MarchingIDList [ CellIndex ];
+
+					if ( MarchingID == 0 || MarchingID == 255 )
+					{
+						continue;
+					}
+
+					const FIntVector CellLocation = FIntVector ( X , Y , Z );
+					const bool       bIsSolid     = ( MarchingID & 1 ) != 0;
+
+					// Edge start at corner 0 of this cell, the four cell around it share the edge
+					for ( int32 Axis = 0 ; Axis < 3 ; ++Axis )
+					{
+						const int32 UAxis = ( Axis + 1 ) % 3;
+						const int32 VAxis = ( Axis + 2 ) % 3;
+
+						if ( CellLocation [ Axis ] >= MarchingSize [ Axis ] - 1 || CellLocation [ UAxis ] == 0 || CellLocation [ VAxis ] == 0 )
+						{
+							continue;
+						}
+
+						if ( bIsSolid == ( ( ( MarchingID >> ( 1 << Axis ) ) & 1 ) != 0 ) )
+						{
+							continue;
+						}
+
+						FIntVector UStep = FIntVector::ZeroValue;
+						FIntVector VStep = FIntVector::ZeroValue;
+
+						UStep [ UAxis ] = 1;
+						VStep [ VAxis ] = 1;
+
+						const uint32 Vertex00 = GetCellVertex ( CellLocation - UStep - VStep );
+						const uint32 Vertex10 = GetCellVertex ( CellLocation - VStep );
+						const uint32 Vertex11 = GetCellVertex ( CellLocation );
+						const uint32 Vertex01 = GetCellVertex ( CellLocation - UStep );
+
+						// Face toward the empty side in left hand winding
+						if ( bIsSolid )
+						{
+							AddTriangle ( Vertex00 , Vertex11 , Vertex10 );
+							AddTriangle ( Vertex00 , Vertex01 , Vertex11 );
+						}
+						else
+						{
+							AddTriangle ( Vertex00 , Vertex10 , Vertex11 );
+							AddTriangle ( Vertex00 , Vertex11 , Vertex01 );
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/* Merge visible voxel face of the same layer into quad one slice at a time, layer solid is only use to pick material */
+	static void BuildGreedyMesh ( FLPPDynamicMeshStreamData& Target , TArray < int32 >& FaceMask , const FLPPMarchingSolidCache& SolidList , const TArray < FLPPMarchingSolidCache >& LayerSolidList , const TArray < FLPPMarchingLayerSetting >& LayerList , const FIntVector& DataSize , const FVector3f& CellSize , const FVector3f& BoundHalfSize , const FBoxUVProjector* BoxUVProjector = nullptr )
+	{
+		for ( int32 Axis = 0 ; Axis < 3 ; ++Axis )
+		{
+			const int32 UAxis = ( Axis + 1 ) % 3;
+			const int32 VAxis = ( Axis + 2 ) % 3;
+
+			const int32 USize = DataSize [ UAxis ];
+			const int32 VSize = DataSize [ VAxis ];
+
+			FaceMask.SetNumUninitialized ( USize * VSize , EAllowShrinking::No );
+
+			for ( int32 Sign = -1 ; Sign <= 1 ; Sign += 2 )
+			{
+				FIntVector Direction = FIntVector::ZeroValue;
+				FVector3f  Normal    = FVector3f::ZeroVector;
+
+				Direction [ Axis ] = Sign;
+				Normal [ Axis ]    = Sign;
+
+				const int32 UVFaceIndex = BoxUVProjector != nullptr ? BoxUVProjector->GetFaceIndex ( Normal ) : INDEX_NONE;
+
+				for ( int32 Depth = 0 ; Depth < DataSize [ Axis ] ; ++Depth )
+				{
+					// Layer index plus one , zero is no face
+					for ( int32 V = 0 ; V < VSize ; ++V )
+					{
+						for ( int32 U = 0 ; U < USize ; ++U )
+						{
+							FIntVector DataLocation;
+
+							DataLocation [ Axis ]  = Depth;
+							DataLocation [ UAxis ] = U;
+							DataLocation [ VAxis ] = V;
+
+							int32& MaskValue = FaceMask [ U + ( V * USize ) ];
+
+							MaskValue = 0;
+
+							if ( SolidList.IsFaceVisible ( DataLocation , Direction ) )
+							{
+								const FIntVector CacheLocation = DataLocation + FIntVector ( 1 );
+
+								MaskValue = LayerSolidList.IndexOfByPredicate ( [&] ( const FLPPMarchingSolidCache& LayerSolid ) { return LayerSolid.Get ( CacheLocation ); } ) + 1;
+							}
+						}
+					}
+
+					const float PlaneOffset = ( ( Depth + ( Sign > 0 ? 1 : 0 ) ) * CellSize [ Axis ] ) - BoundHalfSize [ Axis ];
+
+					const auto AddVertex = [&] ( const int32 QuadU , const int32 QuadV )
+					{
+						FVector3f Position = FVector3f::ZeroVector;
+
+						Position [ Axis ]  = PlaneOffset;
+						Position [ UAxis ] = ( QuadU * CellSize [ UAxis ] ) - BoundHalfSize [ UAxis ];
+						Position [ VAxis ] = ( QuadV * CellSize [ VAxis ] ) - BoundHalfSize [ VAxis ];
+
+						const uint32 VertexIndex = Target.PositionList.Add ( Position );
+
+						Target.NormalList.Add ( Normal );
+						Target.UVList.Add ( BoxUVProjector != nullptr ? BoxUVProjector->GetUV ( Position , UVFaceIndex ) : FVector2f ( QuadU , QuadV ) );
+
+						return VertexIndex;
+					};
+
+					const auto AddTriangle = [&] ( const uint32 A , const uint32 B , const uint32 C , const uint8 MaterialID )
+					{
+						Target.IndexList.Add ( A );
+						Target.IndexList.Add ( B );
+						Target.IndexList.Add ( C );
+						Target.MaterialList.Add ( MaterialID );
+					};
+
+					for ( int32 V = 0 ; V < VSize ; ++V )
+					{
+						for ( int32 U = 0 ; U < USize ; ++U )
+						{
+							const int32 MaskValue = FaceMask [ U + ( V * USize ) ];
+
+							if ( MaskValue == 0 )
+							{
+								continue;
+							}
+
+							int32 Width = 1;
+
+							while ( U + Width < USize && FaceMask [ U + Width + ( V * USize ) ] == MaskValue )
+							{
+								++Width;
+							}
+
+							int32 Height = 1;
+
+							for ( ; V + Height < VSize ; ++Height )
+							{
+								bool bIsRowMatch = true;
+
+								for ( int32 Step = 0 ; Step < Width && bIsRowMatch ; ++Step )
+								{
+									bIsRowMatch = FaceMask [ U + Step + ( ( V + Height ) * USize ) ] == MaskValue;
+								}
+
+								if ( bIsRowMatch == false )
+								{
+									break;
+								}
+							}
+
+							for ( int32 StepV = 0 ; StepV < Height ; ++StepV )
+							{
+								FMemory::Memzero ( FaceMask.GetData ( ) + U + ( ( V + StepV ) * USize ) , Width * sizeof ( int32 ) );
+							}
+
+							const uint8 MaterialID = static_cast < uint8 > ( LayerList [ MaskValue - 1 ].MaterialOffset );
+
+							const uint32 Vertex00 = AddVertex ( U , V );
+							const uint32 Vertex10 = AddVertex ( U + Width , V );
+							const uint32 Vertex11 = AddVertex ( U + Width , V + Height );
+							const uint32 Vertex01 = AddVertex ( U , V + Height );
+
+							// Face toward Direction in left hand winding
+							if ( Sign > 0 )
+							{
+								AddTriangle ( Vertex00 , Vertex11 , Vertex10 , MaterialID );
+								AddTriangle ( Vertex00 , Vertex01 , Vertex11 , MaterialID );
+							}
+							else
+							{
+								AddTriangle ( Vertex00 , Vertex10 , Vertex11 , MaterialID );
+								AddTriangle ( Vertex00 , Vertex11 , Vertex01 , MaterialID );
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/* Axis of the chunk face both point lie on, INDEX_NONE when the edge is not on a face */
+	static int32 GetSkirtAxis ( const FVector3f& A , const FVector3f& B , const FVector3f& BoundHalfSize , const float Tolerance )
+	{
+		for ( int32 Axis = 0 ; Axis < 3 ; ++Axis )
+		{
+			for ( const float Sign : { -1.0f , 1.0f } )
+			{
+				if ( FMath::Abs ( ( A [ Axis ] * Sign ) - BoundHalfSize [ Axis ] ) <= Tolerance && FMath::Abs ( ( B [ Axis ] * Sign ) - BoundHalfSize [ Axis ] ) <= Tolerance )
+				{
+					return Axis;
+				}
+			}
+		}
+
+		return INDEX_NONE;
+	}
+
+	/* Skirt go along the chunk face toward the solid side, so it fill the gap against a neighbour build on other LOD */
+	static bool GetSkirtOffset ( FVector3f& OutOffset , const FVector3f& NormalA , const FVector3f& NormalB , const int32 Axis , const float SkirtDepth )
+	{
+		FVector3f Direction = -( NormalA + NormalB );
+
+		Direction [ Axis ] = 0.0f;
+
+		if ( Direction.Normalize ( ) == false )
+		{
+			return false;
+		}
+
+		OutOffset = Direction * SkirtDepth;
+
+		return true;
+	}
+
+	/* Open edge is an edge without its reverse edge, found by weld lattice so unshared vertex still match */
+	static void AddStreamSkirt ( FLPPDynamicMeshStreamData& Target , const FVector3f& BoundHalfSize , const float SkirtDepth , const float WeldDistance )
+	{
+		const float InvWeldDistance = 1.0f / FMath::Max ( WeldDistance , UE_KINDA_SMALL_NUMBER );
+
+		const int32 TriangleCount = Target.TriangleCount ( );
+
+		TSet < TPair < FIntVector , FIntVector > > EdgeSet;
+
+		EdgeSet.Reserve ( TriangleCount * 3 );
+
+		for ( int32 TriangleIndex = 0 ; TriangleIndex < TriangleCount ; ++TriangleIndex )
+		{
+			for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+			{
+				EdgeSet.Add ( TPair < FIntVector , FIntVector > (
+				                                                 ToLatticeKey ( Target.PositionList [ Target.IndexList [ ( TriangleIndex * 3 ) + Corner ] ] , InvWeldDistance ) ,
+				                                                 ToLatticeKey ( Target.PositionList [ Target.IndexList [ ( TriangleIndex * 3 ) + ( ( Corner + 1 ) % 3 ) ] ] , InvWeldDistance )
+				                                                ) );
+			}
+		}
+
+		const auto AddSkirtVertex = [&] ( const uint32 SourceIndex , const FVector3f& Offset )
+		{
+			// Copy first, Add can't take element of the array it grow
+			const FVector3f Position = Target.PositionList [ SourceIndex ] + Offset;
+			const FVector3f Normal   = Target.NormalList [ SourceIndex ];
+			const FVector2f UV       = Target.UVList [ SourceIndex ];
+
+			const uint32 VertexIndex = Target.PositionList.Add ( Position );
+
+			Target.NormalList.Add ( Normal );
+			Target.UVList.Add ( UV );
+
+			return VertexIndex;
+		};
+
+		for ( int32 TriangleIndex = 0 ; TriangleIndex < TriangleCount ; ++TriangleIndex )
+		{
+			for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+			{
+				const uint32 IndexA = Target.IndexList [ ( TriangleIndex * 3 ) + Corner ];
+				const uint32 IndexB = Target.IndexList [ ( TriangleIndex * 3 ) + ( ( Corner + 1 ) % 3 ) ];
+
+				const int32 Axis = GetSkirtAxis ( Target.PositionList [ IndexA ] , Target.PositionList [ IndexB ] , BoundHalfSize , WeldDistance );
+
+				if ( Axis == INDEX_NONE || EdgeSet.Contains ( TPair < FIntVector , FIntVector > ( ToLatticeKey ( Target.PositionList [ IndexB ] , InvWeldDistance ) , ToLatticeKey ( Target.PositionList [ IndexA ] , InvWeldDistance ) ) ) )
+				{
+					continue;
+				}
+
+				FVector3f Offset;
+
+				if ( GetSkirtOffset ( Offset , Target.NormalList [ IndexA ] , Target.NormalList [ IndexB ] , Axis , SkirtDepth ) == false )
+				{
+					continue;
+				}
+
+				const uint8  MaterialID  = Target.MaterialList [ TriangleIndex ];
+				const uint32 SkirtIndexA = AddSkirtVertex ( IndexA , Offset );
+				const uint32 SkirtIndexB = AddSkirtVertex ( IndexB , Offset );
+
+				// Reverse of the open edge so skirt face the same side as the surface
+				Target.IndexList.Append ( { IndexB , IndexA , SkirtIndexA , IndexB , SkirtIndexA , SkirtIndexB } );
+				Target.MaterialList.Append ( { MaterialID , MaterialID } );
+			}
+		}
+	}
+
+	/* Same as AddStreamSkirt on a welded FDynamicMesh3, boundary edge is already know by the mesh */
+	static void AddMeshSkirt ( FDynamicMesh3& Mesh , const FVector3f& BoundHalfSize , const float SkirtDepth , const float WeldDistance )
+	{
+		FDynamicMeshNormalOverlay*     NormalOverlay     = Mesh.Attributes ( )->PrimaryNormals ( );
+		FDynamicMeshUVOverlay*         UVOverlay         = Mesh.Attributes ( )->PrimaryUV ( );
+		FDynamicMeshMaterialAttribute* MaterialAttribute = Mesh.Attributes ( )->GetMaterialID ( );
+
+		// Mesh grow while skirt is add
+		TArray < int32 > BoundaryEdgeList;
+
+		for ( const int32 EdgeID : Mesh.BoundaryEdgeIndicesItr ( ) )
+		{
+			BoundaryEdgeList.Add ( EdgeID );
+		}
+
+		for ( const int32 EdgeID : BoundaryEdgeList )
+		{
+			const UE::Geometry::FIndex2i EdgeV      = Mesh.GetOrientedBoundaryEdgeV ( EdgeID );
+			const int32                  TriangleID = Mesh.GetEdgeT ( EdgeID ).A;
+
+			const FVector3f PositionA = FVector3f ( Mesh.GetVertex ( EdgeV.A ) );
+			const FVector3f PositionB = FVector3f ( Mesh.GetVertex ( EdgeV.B ) );
+
+			const int32 Axis = GetSkirtAxis ( PositionA , PositionB , BoundHalfSize , WeldDistance );
+
+			if ( Axis == INDEX_NONE )
+			{
+				continue;
+			}
+
+			const int32 NormalIDA = NormalOverlay->GetElementIDAtVertex ( TriangleID , EdgeV.A );
+			const int32 NormalIDB = NormalOverlay->GetElementIDAtVertex ( TriangleID , EdgeV.B );
+			const int32 UVIDA     = UVOverlay->GetElementIDAtVertex ( TriangleID , EdgeV.A );
+			const int32 UVIDB     = UVOverlay->GetElementIDAtVertex ( TriangleID , EdgeV.B );
+
+			if ( NormalIDA == INDEX_NONE || NormalIDB == INDEX_NONE )
+			{
+				continue;
+			}
+
+			FVector3f Offset;
+
+			if ( GetSkirtOffset ( Offset , NormalOverlay->GetElement ( NormalIDA ) , NormalOverlay->GetElement ( NormalIDB ) , Axis , SkirtDepth ) == false )
+			{
+				continue;
+			}
+
+			const int32 SkirtVertexA = Mesh.AppendVertex ( FVector3d ( PositionA + Offset ) );
+			const int32 SkirtVertexB = Mesh.AppendVertex ( FVector3d ( PositionB + Offset ) );
+
+			const int32 SkirtNormalA = NormalOverlay->AppendElement ( NormalOverlay->GetElement ( NormalIDA ) );
+			const int32 SkirtNormalB = NormalOverlay->AppendElement ( NormalOverlay->GetElement ( NormalIDB ) );
+			const int32 SkirtUVA     = UVIDA != INDEX_NONE ? UVOverlay->AppendElement ( UVOverlay->GetElement ( UVIDA ) ) : INDEX_NONE;
+			const int32 SkirtUVB     = UVIDB != INDEX_NONE ? UVOverlay->AppendElement ( UVOverlay->GetElement ( UVIDB ) ) : INDEX_NONE;
+
+			const int32 GroupID    = Mesh.GetTriangleGroup ( TriangleID );
+			const int32 MaterialID = MaterialAttribute->GetValue ( TriangleID );
+
+			const auto AddSkirtTriangle = [&] ( const UE::Geometry::FIndex3i& VertexID , const UE::Geometry::FIndex3i& NormalID , const UE::Geometry::FIndex3i& UVID )
+			{
+				const int32 SkirtTriangleID = Mesh.AppendTriangle ( VertexID , GroupID );
+
+				if ( SkirtTriangleID < 0 )
+				{
+					return;
+				}
+
+				NormalOverlay->SetTriangle ( SkirtTriangleID , NormalID );
+
+				if ( UVID.A != INDEX_NONE && UVID.B != INDEX_NONE && UVID.C != INDEX_NONE )
+				{
+					UVOverlay->SetTriangle ( SkirtTriangleID , UVID );
+				}
+
+				MaterialAttribute->SetValue ( SkirtTriangleID , MaterialID );
+			};
+
+			// Reverse of the open edge so skirt face the same side as the surface
+			AddSkirtTriangle ( { EdgeV.B , EdgeV.A , SkirtVertexA } , { NormalIDB , NormalIDA , SkirtNormalA } , { UVIDB , UVIDA , SkirtUVA } );
+			AddSkirtTriangle ( { EdgeV.B , SkirtVertexA , SkirtVertexB } , { NormalIDB , SkirtNormalA , SkirtNormalB } , { UVIDB , SkirtUVA , SkirtUVB } );
+		}
+	}
+
+	/* Boundary loop and attribute of one coplanar region, only fill for region that can be rebuild */
+	struct FPlanarRegion
+	{
+		TArray < int32 > TriangleList;
+
+		/* Boundary vertex in triangle winding order, collinear vertex is drop before rebuild */
+		TArray < int32 > LoopList;
+
+		/* Normal and uv element of every region vertex, region has no seam inside so each vertex has one */
+		TMap < int32 , FIntPoint > ElementMap;
+
+		FVector3d Normal = FVector3d::ZAxisVector;
+
+		bool bIsValid = false;
+	};
+
+	/* Flood coplanar triangle by quantized plane key, then rebuild every disk shape region from its boundary without collinear vertex */
+	static void MergePlanarRegion ( FDynamicMesh3& Mesh , const float AngleTolerance , const float DistanceTolerance )
+	{
+		FDynamicMeshNormalOverlay*     NormalOverlay     = Mesh.Attributes ( )->PrimaryNormals ( );
+		FDynamicMeshUVOverlay*         UVOverlay         = Mesh.Attributes ( )->PrimaryUV ( );
+		FDynamicMeshMaterialAttribute* MaterialAttribute = Mesh.Attributes ( )->GetMaterialID ( );
+
+		const double NormalStep   = FMath::Max ( FMath::DegreesToRadians ( static_cast < double > ( AngleTolerance ) ) , UE_KINDA_SMALL_NUMBER );
+		const double DistanceStep = FMath::Max ( static_cast < double > ( DistanceTolerance ) , UE_KINDA_SMALL_NUMBER );
+
+		// X Y Z is normal and W is plane distance
+		TArray < FIntVector4 > PlaneKeyList;
+		TArray < int32 >       RegionIDList;
+
+		PlaneKeyList.SetNumZeroed ( Mesh.MaxTriangleID ( ) );
+		RegionIDList.Init ( INDEX_NONE , Mesh.MaxTriangleID ( ) );
+
+		for ( const int32 TriangleID : Mesh.TriangleIndicesItr ( ) )
+		{
+			const FVector3d Normal   = Mesh.GetTriNormal ( TriangleID );
+			const double    Distance = Normal.Dot ( Mesh.GetTriCentroid ( TriangleID ) );
+
+			PlaneKeyList [ TriangleID ] = FIntVector4 (
+			                                           FMath::RoundToInt ( Normal.X / NormalStep ) ,
+			                                           FMath::RoundToInt ( Normal.Y / NormalStep ) ,
+			                                           FMath::RoundToInt ( Normal.Z / NormalStep ) ,
+			                                           FMath::RoundToInt ( Distance / DistanceStep )
+			                                          );
+		}
+
+		const auto IsMergeable = [&] ( const int32 TriangleID )
+		{
+			return NormalOverlay->IsSetTriangle ( TriangleID ) && UVOverlay->IsSetTriangle ( TriangleID );
+		};
+
+		// New triangle can reuse a removed id, those never belong to a region
+		const auto GetRegionID = [&] ( const int32 TriangleID )
+		{
+			return RegionIDList.IsValidIndex ( TriangleID ) ? RegionIDList [ TriangleID ] : INDEX_NONE;
+		};
+
+		TArray < FPlanarRegion > RegionList;
+
+		/* Flood Fill */
+		{
+			TArray < int32 > StackList;
+
+			for ( const int32 SeedID : Mesh.TriangleIndicesItr ( ) )
+			{
+				if ( RegionIDList [ SeedID ] != INDEX_NONE || IsMergeable ( SeedID ) == false )
+				{
+					continue;
+				}
+
+				const int32 RegionID = RegionList.Num ( );
+
+				FPlanarRegion& Region = RegionList.AddDefaulted_GetRef ( );
+
+				Region.Normal = Mesh.GetTriNormal ( SeedID );
+
+				RegionIDList [ SeedID ] = RegionID;
+
+				StackList.Reset ( );
+				StackList.Add ( SeedID );
+
+				while ( StackList.IsEmpty ( ) == false )
+				{
+					const int32 TriangleID = StackList.Pop ( EAllowShrinking::No );
+
+					Region.TriangleList.Add ( TriangleID );
+
+					const UE::Geometry::FIndex3i TriangleEdge = Mesh.GetTriEdges ( TriangleID );
+
+					for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+					{
+						const UE::Geometry::FIndex2i EdgeT   = Mesh.GetEdgeT ( TriangleEdge [ Corner ] );
+						const int32                  OtherID = EdgeT.A == TriangleID ? EdgeT.B : EdgeT.A;
+
+						if ( OtherID == FDynamicMesh3::InvalidID || RegionIDList [ OtherID ] != INDEX_NONE || IsMergeable ( OtherID ) == false )
+						{
+							continue;
+						}
+
+						if ( PlaneKeyList [ OtherID ] != PlaneKeyList [ SeedID ] || MaterialAttribute->GetValue ( OtherID ) != MaterialAttribute->GetValue ( SeedID ) )
+						{
+							continue;
+						}
+
+						if ( NormalOverlay->IsSeamEdge ( TriangleEdge [ Corner ] ) || UVOverlay->IsSeamEdge ( TriangleEdge [ Corner ] ) )
+						{
+							continue;
+						}
+
+						RegionIDList [ OtherID ] = RegionID;
+
+						StackList.Add ( OtherID );
+					}
+				}
+			}
+		}
+
+		/* Region Topology */
+		for ( int32 RegionID = 0 ; RegionID < RegionList.Num ( ) ; ++RegionID )
+		{
+			FPlanarRegion& Region = RegionList [ RegionID ];
+
+			// Two triangle is already the smallest a quad can be
+			if ( Region.TriangleList.Num ( ) < 3 )
+			{
+				continue;
+			}
+
+			TMap < int32 , int32 > NextVertexMap;
+			TSet < int32 >         EdgeSet;
+
+			bool bIsValid = true;
+
+			for ( const int32 TriangleID : Region.TriangleList )
+			{
+				const UE::Geometry::FIndex3i Triangle       = Mesh.GetTriangle ( TriangleID );
+				const UE::Geometry::FIndex3i TriangleEdge   = Mesh.GetTriEdges ( TriangleID );
+				const UE::Geometry::FIndex3i NormalTriangle = NormalOverlay->GetTriangle ( TriangleID );
+				const UE::Geometry::FIndex3i UVTriangle     = UVOverlay->GetTriangle ( TriangleID );
+
+				for ( int32 Corner = 0 ; Corner < 3 && bIsValid ; ++Corner )
+				{
+					const FIntPoint  Element    = FIntPoint ( NormalTriangle [ Corner ] , UVTriangle [ Corner ] );
+					const FIntPoint& OldElement = Region.ElementMap.FindOrAdd ( Triangle [ Corner ] , Element );
+
+					EdgeSet.Add ( TriangleEdge [ Corner ] );
+
+					const UE::Geometry::FIndex2i EdgeT   = Mesh.GetEdgeT ( TriangleEdge [ Corner ] );
+					const int32                  OtherID = EdgeT.A == TriangleID ? EdgeT.B : EdgeT.A;
+
+					if ( OldElement != Element )
+					{
+						bIsValid = false;
+					}
+					else if ( OtherID == FDynamicMesh3::InvalidID || GetRegionID ( OtherID ) != RegionID )
+					{
+						// Pinch vertex would walk two loop
+						bIsValid = NextVertexMap.Contains ( Triangle [ Corner ] ) == false;
+
+						NextVertexMap.Add ( Triangle [ Corner ] , Triangle [ ( Corner + 1 ) % 3 ] );
+					}
+				}
+			}
+
+			// Disk only , V - E + F is one and there is a single boundary loop
+			if ( bIsValid == false || Region.ElementMap.Num ( ) - EdgeSet.Num ( ) + Region.TriangleList.Num ( ) != 1 || NextVertexMap.IsEmpty ( ) )
+			{
+				continue;
+			}
+
+			const int32 StartVertex = NextVertexMap.CreateConstIterator ( ).Key ( );
+
+			int32 CurrentVertex = StartVertex;
+
+			do
+			{
+				Region.LoopList.Add ( CurrentVertex );
+
+				const int32* NextVertexPtr = NextVertexMap.Find ( CurrentVertex );
+
+				CurrentVertex = NextVertexPtr != nullptr ? *NextVertexPtr : StartVertex;
+			}
+			while ( CurrentVertex != StartVertex && Region.LoopList.Num ( ) <= NextVertexMap.Num ( ) );
+
+			if ( Region.LoopList.Num ( ) != NextVertexMap.Num ( ) )
+			{
+				Region.LoopList.Reset ( );
+
+				continue;
+			}
+
+			// Re-triangulate would stretch uv that is not linear over the region
+			{
+				const UE::Geometry::FIndex3i SeedTriangle = Mesh.GetTriangle ( Region.TriangleList [ 0 ] );
+
+				const UE::Geometry::FFrame3d Frame ( Mesh.GetVertex ( SeedTriangle.A ) , Region.Normal );
+
+				const FVector2d Point0 = Frame.ToPlaneUV ( Mesh.GetVertex ( SeedTriangle.A ) , 2 );
+				const FVector2d Point1 = Frame.ToPlaneUV ( Mesh.GetVertex ( SeedTriangle.B ) , 2 );
+				const FVector2d Point2 = Frame.ToPlaneUV ( Mesh.GetVertex ( SeedTriangle.C ) , 2 );
+
+				const FVector2f UV0 = UVOverlay->GetElement ( Region.ElementMap [ SeedTriangle.A ].Y );
+				const FVector2f UV1 = UVOverlay->GetElement ( Region.ElementMap [ SeedTriangle.B ].Y );
+				const FVector2f UV2 = UVOverlay->GetElement ( Region.ElementMap [ SeedTriangle.C ].Y );
+
+				const double Area = UE::Geometry::DotPerp ( Point1 - Point0 , Point2 - Point0 );
+
+				if ( FMath::Abs ( Area ) <= UE_KINDA_SMALL_NUMBER )
+				{
+					Region.LoopList.Reset ( );
+
+					continue;
+				}
+
+				for ( const TPair < int32 , FIntPoint >& ElementPair : Region.ElementMap )
+				{
+					const FVector2d Point = Frame.ToPlaneUV ( Mesh.GetVertex ( ElementPair.Key ) , 2 );
+
+					const double Weight1 = UE::Geometry::DotPerp ( Point - Point0 , Point2 - Point0 ) / Area;
+					const double Weight2 = UE::Geometry::DotPerp ( Point1 - Point0 , Point - Point0 ) / Area;
+
+					const FVector2f ExpectUV = UV0 + ( ( UV1 - UV0 ) * Weight1 ) + ( ( UV2 - UV0 ) * Weight2 );
+
+					if ( FVector2f::DistSquared ( ExpectUV , UVOverlay->GetElement ( ElementPair.Value.Y ) ) > FMath::Square ( 1e-3f ) )
+					{
+						bIsValid = false;
+
+						break;
+					}
+				}
+			}
+
+			Region.bIsValid = bIsValid;
+
+			if ( bIsValid == false )
+			{
+				Region.LoopList.Reset ( );
+			}
+		}
+
+		// Collinear vertex is only drop when every region around it is rebuild, else neighbour keep it and a T junction appear
+		const auto IsVertexRemovable = [&] ( const int32 VertexID , const int32 PrevVertexID , const int32 NextVertexID )
+		{
+			if ( Mesh.IsBoundaryVertex ( VertexID ) )
+			{
+				return false;
+			}
+
+			int32 RegionBoundaryCount = 0;
+
+			for ( const int32 EdgeID : Mesh.VtxEdgesItr ( VertexID ) )
+			{
+				const UE::Geometry::FIndex2i EdgeT = Mesh.GetEdgeT ( EdgeID );
+
+				const int32 RegionA = GetRegionID ( EdgeT.A );
+				const int32 RegionB = GetRegionID ( EdgeT.B );
+
+				if ( RegionA == INDEX_NONE || RegionB == INDEX_NONE || RegionList [ RegionA ].bIsValid == false || RegionList [ RegionB ].bIsValid == false )
+				{
+					return false;
+				}
+
+				RegionBoundaryCount += RegionA != RegionB ? 1 : 0;
+			}
+
+			if ( RegionBoundaryCount != 2 )
+			{
+				return false;
+			}
+
+			const FVector3d Position = Mesh.GetVertex ( VertexID );
+			const FVector3d PrevEdge = Position - Mesh.GetVertex ( PrevVertexID );
+			const FVector3d NextEdge = Mesh.GetVertex ( NextVertexID ) - Position;
+
+			return PrevEdge.Dot ( NextEdge ) > 0.0 && PrevEdge.Cross ( NextEdge ).Length ( ) <= 1e-3 * PrevEdge.Length ( ) * NextEdge.Length ( );
+		};
+
+		// Decide on the untouch mesh so both region along a shared edge drop the same vertex
+		for ( FPlanarRegion& Region : RegionList )
+		{
+			if ( Region.bIsValid == false )
+			{
+				continue;
+			}
+
+			TArray < int32 > PolygonVertexList;
+
+			for ( int32 LoopIndex = 0 ; LoopIndex < Region.LoopList.Num ( ) ; ++LoopIndex )
+			{
+				const int32 VertexID     = Region.LoopList [ LoopIndex ];
+				const int32 PrevVertexID = Region.LoopList [ ( LoopIndex + Region.LoopList.Num ( ) - 1 ) % Region.LoopList.Num ( ) ];
+				const int32 NextVertexID = Region.LoopList [ ( LoopIndex + 1 ) % Region.LoopList.Num ( ) ];
+
+				if ( IsVertexRemovable ( VertexID , PrevVertexID , NextVertexID ) == false )
+				{
+					PolygonVertexList.Add ( VertexID );
+				}
+			}
+
+			Region.LoopList = MoveTemp ( PolygonVertexList );
+		}
+
+		/* Rebuild */
+		TMap < TPair < int32 , int32 > , int32 > NewEdgeUseMap;
+
+		TArray < FVector2d >              PolygonPointList;
+		TArray < UE::Geometry::FIndex3i > PolygonTriangleList;
+
+		for ( int32 RegionID = 0 ; RegionID < RegionList.Num ( ) ; ++RegionID )
+		{
+			FPlanarRegion& Region = RegionList [ RegionID ];
+
+			const TArray < int32 >& PolygonVertexList = Region.LoopList;
+
+			if ( Region.bIsValid == false || PolygonVertexList.Num ( ) < 3 )
+			{
+				continue;
+			}
+
+			const UE::Geometry::FFrame3d Frame ( Mesh.GetVertex ( PolygonVertexList [ 0 ] ) , Region.Normal );
+
+			PolygonPointList.Reset ( );
+
+			for ( const int32 VertexID : PolygonVertexList )
+			{
+				PolygonPointList.Add ( Frame.ToPlaneUV ( Mesh.GetVertex ( VertexID ) , 2 ) );
+			}
+
+			PolygonTriangleList.Reset ( );
+
+			PolygonTriangulation::TriangulateSimplePolygon < double > ( PolygonPointList , PolygonTriangleList );
+
+			if ( PolygonTriangleList.Num ( ) != PolygonVertexList.Num ( ) - 2 )
+			{
+				continue;
+			}
+
+			// Edge keep by other triangle must stay manifold after the region is replace
+			{
+				NewEdgeUseMap.Reset ( );
+
+				bool bIsConflict = false;
+
+				for ( UE::Geometry::FIndex3i& PolygonTriangle : PolygonTriangleList )
+				{
+					PolygonTriangle = UE::Geometry::FIndex3i ( PolygonVertexList [ PolygonTriangle.A ] , PolygonVertexList [ PolygonTriangle.B ] , PolygonVertexList [ PolygonTriangle.C ] );
+
+					if ( UE::Geometry::VectorUtil::Normal ( Mesh.GetVertex ( PolygonTriangle.A ) , Mesh.GetVertex ( PolygonTriangle.B ) , Mesh.GetVertex ( PolygonTriangle.C ) ).Dot ( Region.Normal ) < 0.0 )
+					{
+						Swap ( PolygonTriangle.B , PolygonTriangle.C );
+					}
+
+					for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+					{
+						const int32 VertexA = PolygonTriangle [ Corner ];
+						const int32 VertexB = PolygonTriangle [ ( Corner + 1 ) % 3 ];
+
+						NewEdgeUseMap.FindOrAdd ( TPair < int32 , int32 > ( FMath::Min ( VertexA , VertexB ) , FMath::Max ( VertexA , VertexB ) ) , 0 ) += 1;
+					}
+				}
+
+				for ( const TPair < TPair < int32 , int32 > , int32 >& EdgeUse : NewEdgeUseMap )
+				{
+					const int32 EdgeID = Mesh.FindEdge ( EdgeUse.Key.Key , EdgeUse.Key.Value );
+
+					int32 KeepCount = 0;
+
+					if ( EdgeID != FDynamicMesh3::InvalidID )
+					{
+						const UE::Geometry::FIndex2i EdgeT = Mesh.GetEdgeT ( EdgeID );
+
+						KeepCount += EdgeT.A != FDynamicMesh3::InvalidID && GetRegionID ( EdgeT.A ) != RegionID ? 1 : 0;
+						KeepCount += EdgeT.B != FDynamicMesh3::InvalidID && GetRegionID ( EdgeT.B ) != RegionID ? 1 : 0;
+					}
+
+					if ( KeepCount + EdgeUse.Value > 2 )
+					{
+						bIsConflict = true;
+
+						break;
+					}
+				}
+
+				if ( bIsConflict )
+				{
+					continue;
+				}
+			}
+
+			const int32 GroupID    = Mesh.GetTriangleGroup ( Region.TriangleList [ 0 ] );
+			const int32 MaterialID = MaterialAttribute->GetValue ( Region.TriangleList [ 0 ] );
+
+			// Element is free with its last triangle, copy value so it can be add back
+			TMap < int32 , TPair < FVector3f , FVector2f > > ElementValueMap;
+
+			for ( const int32 VertexID : PolygonVertexList )
+			{
+				const FIntPoint& Element = Region.ElementMap [ VertexID ];
+
+				ElementValueMap.Add ( VertexID , TPair < FVector3f , FVector2f > ( NormalOverlay->GetElement ( Element.X ) , UVOverlay->GetElement ( Element.Y ) ) );
+			}
+
+			for ( const int32 TriangleID : Region.TriangleList )
+			{
+				Mesh.RemoveTriangle ( TriangleID , false , false );
+			}
+
+			for ( const int32 VertexID : PolygonVertexList )
+			{
+				FIntPoint& Element = Region.ElementMap [ VertexID ];
+
+				if ( NormalOverlay->IsElement ( Element.X ) == false )
+				{
+					Element.X = NormalOverlay->AppendElement ( ElementValueMap [ VertexID ].Key );
+				}
+
+				if ( UVOverlay->IsElement ( Element.Y ) == false )
+				{
+					Element.Y = UVOverlay->AppendElement ( ElementValueMap [ VertexID ].Value );
+				}
+			}
+
+			for ( const UE::Geometry::FIndex3i& PolygonTriangle : PolygonTriangleList )
+			{
+				const int32 TriangleID = Mesh.AppendTriangle ( PolygonTriangle , GroupID );
+
+				if ( TriangleID < 0 )
+				{
+					continue;
+				}
+
+				if ( RegionIDList.IsValidIndex ( TriangleID ) )
+				{
+					RegionIDList [ TriangleID ] = INDEX_NONE;
+				}
+
+				const FIntPoint& ElementA = Region.ElementMap [ PolygonTriangle.A ];
+				const FIntPoint& ElementB = Region.ElementMap [ PolygonTriangle.B ];
+				const FIntPoint& ElementC = Region.ElementMap [ PolygonTriangle.C ];
+
+				NormalOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( ElementA.X , ElementB.X , ElementC.X ) );
+				UVOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( ElementA.Y , ElementB.Y , ElementC.Y ) );
+				MaterialAttribute->SetValue ( TriangleID , MaterialID );
+			}
+		}
+	}
+}
+
 // Sets default values for this component's properties
 ULPPMarchingMeshComponent::ULPPMarchingMeshComponent ( )
 {
@@ -35,6 +1341,17 @@ ULPPMarchingMeshComponent::ULPPMarchingMeshComponent ( )
 	// ...
 }
 
+void ULPPMarchingMeshComponent::PostLoad ( )
+{
+	Super::PostLoad ( );
+
+	// Queue setting is per world, so a custom value can't be map per component
+	if ( MeshUpdateBoundRadius_DEPRECATED != 6400.0f || FastUpdateRadius_DEPRECATED != 3200.0f )
+	{
+		UE_LOG ( LogTemp , Warning , TEXT ( "MarchingMeshComponent ( %s ) FastUpdateRadius and MeshUpdateBoundRadius are no longer use, setup the rebuild queue with SetupRebuildQueue" ) , *GetPathName ( ) );
+	}
+}
+
 // Called when the game starts
 void ULPPMarchingMeshComponent::BeginPlay ( )
 {
@@ -80,7 +1397,7 @@ FVector ULPPMarchingMeshComponent::GetMeshSize ( ) const
 {
 	if ( IsDataComponentValid ( ) )
 	{
-		return RenderSetting->GetMarchingSize ( );
+		return GetPrimaryRenderSetting ( )->GetMarchingSize ( );
 	}
 
 	return FVector ( 0.0f );
@@ -88,7 +1405,7 @@ FVector ULPPMarchingMeshComponent::GetMeshSize ( ) const
 
 bool ULPPMarchingMeshComponent::IsDataComponentValid ( ) const
 {
-	return IsValid ( GetWorld ( ) ) && IsValid ( DataComponent ) && IsValid ( PositionComponent ) && IsValid ( RenderSetting ) && DataComponent->IsChunkIndexValid ( RegionIndex , ChunkIndex );
+	return IsValid ( GetWorld ( ) ) && IsValid ( DataComponent ) && IsValid ( PositionComponent ) && IsValid ( GetPrimaryRenderSetting ( ) ) && DataComponent->IsChunkIndexValid ( RegionIndex , ChunkIndex );
 }
 
 void ULPPMarchingMeshComponent::GetFaceCullingSetting ( bool& bIsChunkFaceCullingDisable , bool& bIsRegionFaceCullingDisable ) const
@@ -98,8 +1415,8 @@ void ULPPMarchingMeshComponent::GetFaceCullingSetting ( bool& bIsChunkFaceCullin
 
 	if ( IsDataComponentValid ( ) )
 	{
-		bIsChunkFaceCullingDisable  = RenderSetting->IsChunkFaceCullingDisable ( );
-		bIsRegionFaceCullingDisable = RenderSetting->IsRegionFaceCullingDisable ( );
+		bIsChunkFaceCullingDisable  = GetPrimaryRenderSetting ( )->IsChunkFaceCullingDisable ( );
+		bIsRegionFaceCullingDisable = GetPrimaryRenderSetting ( )->IsRegionFaceCullingDisable ( );
 	}
 }
 
@@ -115,7 +1432,7 @@ uint8 ULPPMarchingMeshComponent::GetMarchingID ( const FIntVector& Offset ) cons
 			const FIntVector   DataIndex      = PositionComponent->AddOffsetToDataGridIndex ( FIntVector ( RegionIndex , ChunkIndex , 0 ) , Offset + MarchingOffset );
 			const FGameplayTag CellTag        = DataComponent->GetCellTag ( DataIndex.X , DataIndex.Y , DataIndex.Z );
 
-			if ( CellTag.MatchesTag ( HandleTag ) )
+			if ( IsHandleTag ( CellTag ) )
 			{
 				MarchingID |= ( 1 << MarchingIndex );
 			}
@@ -127,37 +1444,43 @@ uint8 ULPPMarchingMeshComponent::GetMarchingID ( const FIntVector& Offset ) cons
 	return 0;
 }
 
-float ULPPMarchingMeshComponent::GetPlayerDistance ( ) const
+void ULPPMarchingMeshComponent::GetLayerSettingList ( TArray < FLPPMarchingLayerSetting >& OutLayerList ) const
 {
-	if ( IsValid ( GetWorld ( ) ) )
-	{
-		float PlayerDist = 0.0f;
+	OutLayerList.Reset ( );
 
-		// Is On Server And Has Authority
-		if ( GetNetMode ( ) != ENetMode::NM_Standalone && GetOwnerRole ( ) == ROLE_Authority )
+	if ( LayerList.IsEmpty ( ) == false )
+	{
+		// Layer without render setting can't be mesh by worker
+		for ( const FLPPMarchingLayerSetting& Layer : LayerList )
 		{
-			for ( FConstPlayerControllerIterator PlayerIt = GetWorld ( )->GetPlayerControllerIterator ( ) ; PlayerIt ; ++PlayerIt )
+			if ( IsValid ( Layer.RenderSetting ) )
 			{
-				if ( APlayerController* PlayerController = PlayerIt->Get ( ) ; IsValid ( PlayerController ) && IsValid ( PlayerController->GetPawnOrSpectator ( ) ) )
-				{
-					PlayerDist = FMath::Min ( FMath::Max ( FVector::Dist ( PlayerController->GetPawnOrSpectator ( )->K2_GetActorLocation ( ) , GetComponentLocation ( ) ) , 1.0f ) , PlayerDist );
-				}
+				OutLayerList.Add ( Layer );
 			}
 		}
-		else
-		{
-			APlayerController* PlayerController = GetWorld ( )->GetFirstPlayerController ( );
 
-			if ( IsValid ( PlayerController ) && IsValid ( PlayerController->GetPawnOrSpectator ( ) ) )
-			{
-				PlayerDist = FMath::Max ( FVector::Dist ( PlayerController->GetPawnOrSpectator ( )->K2_GetActorLocation ( ) , GetComponentLocation ( ) ) , 1.0f );
-			}
-		}
+		return;
+	}
+
+	FLPPMarchingLayerSetting& DefaultLayer = OutLayerList.AddDefaulted_GetRef ( );
+
+	DefaultLayer.HandleTag     = HandleTag;
+	DefaultLayer.RenderSetting = RenderSetting;
+}
+
+ULPPMarchingData* ULPPMarchingMeshComponent::GetPrimaryRenderSetting ( ) const
+{
+	return LayerList.IsEmpty ( ) ? RenderSetting.Get ( ) : LayerList [ 0 ].RenderSetting.Get ( );
+}
 
-		return PlayerDist;
+bool ULPPMarchingMeshComponent::IsHandleTag ( const FGameplayTag& CellTag ) const
+{
+	if ( LayerList.IsEmpty ( ) )
+	{
+		return CellTag.MatchesTag ( HandleTag );
 	}
 
-	return -1.0f;
+	return LayerList.ContainsByPredicate ( [&] ( const FLPPMarchingLayerSetting& Layer ) { return CellTag.MatchesTag ( Layer.HandleTag ); } );
 }
 
 void ULPPMarchingMeshComponent::Initialize ( ULFPChunkedTagDataComponent* NewDataComponent , ULFPChunkedGridPositionComponent* NewPositionComponent , const int32 NewRegionIndex , const int32 NewChunkIndex )
@@ -182,12 +1505,28 @@ void ULPPMarchingMeshComponent::Uninitialize ( )
 
 void ULPPMarchingMeshComponent::ClearRender ( )
 {
+	if ( IsValid ( GetWorld ( ) ) )
+	{
+		if ( ULPPProceduralWorldTaskSubsystem* Subsystem = GetWorld ( )->GetSubsystem < ULPPProceduralWorldTaskSubsystem > ( ) ; IsValid ( Subsystem ) )
+		{
+			Subsystem->CancelRebuild ( this );
+		}
+	}
+
 	MeshComputeData.CancelJob ( );
 	DistanceFieldComputeData.CancelJob ( );
 	AggGeom.EmptyElements ( );
 
 	bIsMeshUpdateNeededAgain = false;
 
+	StreamBlockCache.Reset ( );
+	PendingDirtyBlockSet.Empty ( );
+	PendingDirtyDataSet.Empty ( );
+	bIsFullRebuildPending = true;
+
+	CachedCellSnapshot  = FLPPMarchingCellSnapshot ( );
+	CommittedSolidCache = FLPPMarchingSolidCache ( );
+
 	ClearMesh ( );
 }
 
@@ -200,28 +1539,91 @@ void ULPPMarchingMeshComponent::UpdateRender ( )
 		return;
 	}
 
-	float DelayTime = 0.001f;
+	bIsFullRebuildPending = true;
+
+	QueueRebuild ( );
+}
+
+void ULPPMarchingMeshComponent::QueueRebuild ( )
+{
+	ULPPProceduralWorldTaskSubsystem* Subsystem = GetWorld ( )->GetSubsystem < ULPPProceduralWorldTaskSubsystem > ( );
+
+	if ( IsValid ( Subsystem ) == false )
+	{
+		return;
+	}
+
+	// Queue is order by viewer distance and view cone, so nearby chunk don't wait behind far one
+	Subsystem->RequestRebuild ( this , [this] ( )
+	{
+		UpdateRender_Internal ( );
+
+		return MeshComputeData.LastPendingJobs;
+	} );
+}
 
-	FTimerManager& TimerManager = GetWorld ( )->GetTimerManager ( );
+void ULPPMarchingMeshComponent::UpdateRenderPartial ( const TArray < int32 >& DataIndexList )
+{
+	// Empty list don't say which cell change, so every block is rebuild
+	if ( DataIndexList.IsEmpty ( ) || MesherType != ELPPMarchingMesherType::VertexStream || LODIndex > 0 || StreamBlockCache.IsValid ( ) == false || IsDataComponentValid ( ) == false )
 	{
-		const float PlayerDist = GetPlayerDistance ( );
+		UpdateRender ( );
+
+		return;
+	}
 
-		if ( PlayerDist < FastUpdateRadius )
+	const FIntVector DataSize     = GetDataSize ( );
+	const FIntVector MarchingSize = DataSize + FIntVector ( 1 );
+	const int32      BlockSize    = FMath::Max ( SubBlockSize , 1 );
+	const FIntVector BlockCount   = FIntVector (
+	                                            FMath::DivideAndRoundUp ( MarchingSize.X , BlockSize ) ,
+	                                            FMath::DivideAndRoundUp ( MarchingSize.Y , BlockSize ) ,
+	                                            FMath::DivideAndRoundUp ( MarchingSize.Z , BlockSize )
+	                                           );
+
+	for ( const int32 DataIndex : DataIndexList )
+	{
+		if ( DataIndex < 0 || DataIndex >= GetDataNum ( ) )
 		{
-			DelayTime = 0.001f;
+			continue;
 		}
-		else
+
+		PendingDirtyDataSet.Add ( DataIndex );
+
+		// Data cell N is corner of marching cell N and N + 1
+		const FIntVector DataLocation = ULFPGridLibrary::ToGridLocation ( DataIndex , DataSize );
+		const FIntVector MinBlock     = DataLocation / BlockSize;
+		const FIntVector MaxBlock     = ( DataLocation + FIntVector ( 1 ) ) / BlockSize;
+
+		for ( int32 Z = MinBlock.Z ; Z <= MaxBlock.Z ; ++Z )
 		{
-			DelayTime = FMath::Max ( ( PlayerDist - FastUpdateRadius ) / MeshUpdateBoundRadius , DelayTime );
+			for ( int32 Y = MinBlock.Y ; Y <= MaxBlock.Y ; ++Y )
+			{
+				for ( int32 X = MinBlock.X ; X <= MaxBlock.X ; ++X )
+				{
+					PendingDirtyBlockSet.Add ( ULFPGridLibrary::ToGridIndex ( FIntVector ( X , Y , Z ) , BlockCount ) );
+				}
+			}
 		}
 	}
 
-	if ( TimerManager.IsTimerActive ( UpdateRenderTimer ) && TimerManager.GetTimerRemaining ( UpdateRenderTimer ) < DelayTime && WasRecentlyRendered ( ) )
+	QueueRebuild ( );
+}
+
+void ULPPMarchingMeshComponent::OnRequestChunkUpdate_Implementation ( const TArray < int32 >& DataIndexList , const bool bIsMetaUpdate )
+{
+	// Meta data is not use by marching
+	if ( bIsMetaUpdate )
 	{
 		return;
 	}
 
-	TimerManager.SetTimer ( UpdateRenderTimer , this , &ULPPMarchingMeshComponent::UpdateRender_Internal , DelayTime , false );
+	UpdateRenderPartial ( DataIndexList );
+}
+
+void ULPPMarchingMeshComponent::OnLODChanged_Implementation ( const int32 NewLODIndex )
+{
+	SetLODIndex ( NewLODIndex );
 }
 
 bool ULPPMarchingMeshComponent::IsRendering ( ) const
@@ -229,6 +1631,25 @@ bool ULPPMarchingMeshComponent::IsRendering ( ) const
 	return MeshRenderData.IsValid ( ) && MeshRenderData->IsInitialized ( );
 }
 
+void ULPPMarchingMeshComponent::SetLODIndex ( const int32 NewLODIndex )
+{
+	const int32 ClampedLODIndex = FMath::Clamp ( NewLODIndex , 0 , 2 );
+
+	if ( LODIndex == ClampedLODIndex )
+	{
+		return;
+	}
+
+	LODIndex = ClampedLODIndex;
+
+	UpdateRender ( );
+}
+
+int32 ULPPMarchingMeshComponent::GetLODIndex ( ) const
+{
+	return LODIndex;
+}
+
 void ULPPMarchingMeshComponent::UpdateRender_Internal ( )
 {
 	if ( IsDataComponentValid ( ) == false )
@@ -238,11 +1659,6 @@ void ULPPMarchingMeshComponent::UpdateRender_Internal ( )
 		return;
 	}
 
-	const FIntVector& CacheDataSize  = GetDataSize ( ) + FIntVector ( 2 );
-	const int32       CacheDataIndex = CacheDataSize.X * CacheDataSize.Y * CacheDataSize.Z;
-
-	int32 ValidCount = 0;
-
 	if ( DataComponent->GetCellTagList ( RegionIndex , ChunkIndex ).IsEmpty ( ) )
 	{
 		ClearRender ( );
@@ -259,55 +1675,30 @@ void ULPPMarchingMeshComponent::UpdateRender_Internal ( )
 		return;
 	}
 
-	TBitArray < > CacheDataList = TBitArray ( false , CacheDataIndex );
+	// Partial job keep Lumen card and collision of the current mesh, so it need one
+	if ( MesherType != ELPPMarchingMesherType::VertexStream || IsRendering ( ) == false || CachedCellSnapshot.Size != GetDataSize ( ) + FIntVector ( 2 ) )
 	{
-		/* Generate Marching Mesh Data */
-		for ( int32 SolidIndex = 0 ; SolidIndex < CacheDataIndex ; ++SolidIndex )
-		{
-			const FIntVector CheckOffset = ULFPGridLibrary::ToGridLocation ( SolidIndex , CacheDataSize ) - FIntVector ( 1 );
-			const FIntVector CheckIndex  = PositionComponent->AddOffsetToDataGridIndex ( FIntVector ( RegionIndex , ChunkIndex , 0 ) , CheckOffset );
-
-			if ( RegionIndex != CheckIndex.X && PositionComponent->IsIsolateRegion ( ) )
-			{
-				continue;
-			}
-
-			if ( ChunkIndex != CheckIndex.Y && PositionComponent->IsIsolateChunk ( ) )
-			{
-				continue;
-			}
-
-			if ( CheckIndex.GetMin ( ) == INDEX_NONE )
-			{
-				continue;
-			}
+		bIsFullRebuildPending = true;
+	}
 
-			CacheDataList [ SolidIndex ] = DataComponent->GetCellTag ( CheckIndex.X , CheckIndex.Y , CheckIndex.Z ).MatchesTag ( HandleTag );
+	FLPPMarchingCellSnapshot CellSnapshot;
 
-			if ( CacheDataList [ SolidIndex ] )
-			{
-				ValidCount += 1;
-			}
-		}
+	if ( bIsFullRebuildPending )
+	{
+		CaptureCellSnapshot ( CellSnapshot );
 	}
-
-	// Complete Empty No Need Render Or Inside Other Chunk So Don't Need To Render
-	if ( ValidCount == 0 || CacheDataIndex == ValidCount )
+	else
 	{
-		ClearRender ( );
-
-		if ( CacheDataIndex == ValidCount )
-		{
-			OnMeshSkipOnFull.Broadcast ( this );
-		}
-		else
-		{
-			OnMeshSkipOnEmpty.Broadcast ( this );
-		}
+		CellSnapshot = CachedCellSnapshot;
 
-		return;
+		PatchCellSnapshot ( CellSnapshot , PendingDirtyDataSet );
 	}
 
+	PendingDirtyDataSet.Empty ( );
+
+	// Only partial rebuild read it back
+	CachedCellSnapshot = MesherType == ELPPMarchingMesherType::VertexStream ? CellSnapshot : FLPPMarchingCellSnapshot ( );
+
 	OnMeshRebuilding.Broadcast ( this );
 
 	FLFPMarchingPassData PassData;
@@ -315,22 +1706,54 @@ void ULPPMarchingMeshComponent::UpdateRender_Internal ( )
 	GetFaceCullingSetting ( PassData.bIsChunkFaceCullingDisable , PassData.bIsRegionFaceCullingDisable );
 
 	PassData.bRenderData       = bGenerateRenderData;
+	PassData.MesherType        = MesherType;
 	PassData.MeshFullSize      = GetMeshSize ( );
 	PassData.DataSize          = GetDataSize ( );
 	PassData.BoundExpand       = BoundExpand;
 	PassData.EdgeMergeDistance = EdgeMergeDistance;
+	PassData.SeamNormalAngle   = SeamNormalAngle;
+
+	// LOD cell must tile the chunk exactly or the mesh would not reach the chunk face
+	PassData.LODIndex          = FMath::Clamp ( LODIndex , 0 , 2 );
+	PassData.LODReduction      = LODReduction;
+	PassData.bGenerateLODSkirt = bGenerateLODSkirt;
+
+	while ( PassData.LODIndex > 0 && ( PassData.DataSize.X % ( 1 << PassData.LODIndex ) != 0 || PassData.DataSize.Y % ( 1 << PassData.LODIndex ) != 0 || PassData.DataSize.Z % ( 1 << PassData.LODIndex ) != 0 ) )
+	{
+		PassData.LODIndex -= 1;
+	}
+
+	if ( MesherType == ELPPMarchingMesherType::VertexStream )
+	{
+		if ( StreamBlockCache.IsValid ( ) == false )
+		{
+			StreamBlockCache = MakeShared < FLPPMarchingStreamBlockCache , ESPMode::ThreadSafe > ( );
+
+			bIsFullRebuildPending = true;
+		}
+
+		PassData.StreamBlockCache = StreamBlockCache;
+		PassData.SubBlockSize     = SubBlockSize;
+		PassData.bIsFullRebuild   = bIsFullRebuildPending;
+		PassData.DirtyBlockList   = PendingDirtyBlockSet.Array ( );
+	}
+
+	bIsFullRebuildPending = false;
+	PendingDirtyBlockSet.Empty ( );
 
 	PassData.bSimplifyRenderData = bSimplifyRenderData;
+	PassData.SimplifyMethod      = SimplifyMethod;
 	PassData.SimplifyAngle       = SimplifyAngle;
 
 	PassData.bSimpleBoxCollisionData = bGenerateSimpleBoxCollisionData;
+	PassData.MaxCollisionBoxCount    = MaxCollisionBoxCount;
 
 	PassData.bRecomputeBoxUV = bRecomputeBoxUV;
 	PassData.UVBoxTransform  = UVBoxTransform;
 
 	PassData.StartTime = FDateTime::UtcNow ( );
 
-	PassData.RenderSetting = RenderSetting;
+	GetLayerSettingList ( PassData.LayerList );
 
 	PassData.DataID = ClearMeshCounter;
 
@@ -340,16 +1763,18 @@ void ULPPMarchingMeshComponent::UpdateRender_Internal ( )
 	PassData.bMostlyTwoSided = bMostlyTwoSided;
 	PassData.bNaniteMesh     = bGenerateNaniteMesh;
 
+	PassData.MaxLumenCardCount = MaxLumenCardCount;
+
 	bIsMeshUpdateNeededAgain = false;
 
 	MeshComputeData.LaunchJob ( TEXT ( "MarchingDynamicMeshComponentMeshData" ) ,
-	                            [this, MovedCacheDataList = MoveTemp ( CacheDataList ),MovedPassData = MoveTemp ( PassData )] ( FProgressCancel& Progress , TQueue < TFunction < void  ( ) > , EQueueMode::Mpsc >& GameThreadJob )
+	                            [this, MovedCellSnapshot = MoveTemp ( CellSnapshot ),MovedPassData = MoveTemp ( PassData )] ( FProgressCancel& Progress , TQueue < TFunction < void  ( ) > , EQueueMode::Mpsc >& GameThreadJob )
 	                            {
 		                            LLM_SCOPE_BYTAG ( LFPMarchingMesh );
 
-		                            TUniquePtr < FLFPMarchingThreadData > ThreadData = MakeUnique < FLFPMarchingThreadData > ( );;
+		                            TUniquePtr < FLFPMarchingThreadData > ThreadData = AcquireThreadData ( );
 
-		                            ComputeNewMarchingMesh_TaskFunction ( ThreadData , Progress , MovedCacheDataList , MovedPassData );
+		                            ComputeNewMarchingMesh_TaskFunction ( ThreadData , Progress , MovedCellSnapshot , MovedPassData );
 
 		                            if ( Progress.Cancelled ( ) == false )
 		                            {
@@ -358,7 +1783,7 @@ void ULPPMarchingMeshComponent::UpdateRender_Internal ( )
 
 		                            if ( ThreadData.IsValid ( ) )
 		                            {
-			                            ThreadData.Reset ( );
+			                            ReleaseThreadData ( MoveTemp ( ThreadData ) );
 		                            }
 
 		                            check ( ThreadData.Get ( ) == nullptr );
@@ -367,6 +1792,130 @@ void ULPPMarchingMeshComponent::UpdateRender_Internal ( )
 	return;
 }
 
+TUniquePtr < FLFPMarchingThreadData > ULPPMarchingMeshComponent::AcquireThreadData ( )
+{
+	FScopeLock PoolLock ( &ThreadDataPoolSection );
+
+	if ( ThreadDataPool.IsEmpty ( ) )
+	{
+		return MakeUnique < FLFPMarchingThreadData > ( );
+	}
+
+	return ThreadDataPool.Pop ( EAllowShrinking::No );
+}
+
+void ULPPMarchingMeshComponent::ReleaseThreadData ( TUniquePtr < FLFPMarchingThreadData >&& ThreadData )
+{
+	if ( ThreadData.IsValid ( ) == false )
+	{
+		return;
+	}
+
+	ThreadData->ResetForReuse ( );
+
+	FScopeLock PoolLock ( &ThreadDataPoolSection );
+
+	// One in flight and one waiting for commit is the most a component can have
+	if ( ThreadDataPool.Num ( ) < 2 )
+	{
+		ThreadDataPool.Add ( MoveTemp ( ThreadData ) );
+	}
+	else
+	{
+		ThreadData.Reset ( );
+	}
+}
+
+void ULPPMarchingMeshComponent::CaptureCellSnapshot ( FLPPMarchingCellSnapshot& OutSnapshot ) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE ( MarchingMesh_CaptureCellSnapshot );
+
+	const FIntVector DataSize = GetDataSize ( );
+
+	OutSnapshot.Size = DataSize + FIntVector ( 2 );
+	OutSnapshot.PaletteIndexList.SetNumZeroed ( OutSnapshot.Size.X * OutSnapshot.Size.Y * OutSnapshot.Size.Z );
+
+	OutSnapshot.Palette.FindOrAdd ( FGameplayTag::EmptyTag );
+
+	// Chunk own cell is copy row by row without any grid offset lookup
+	for ( int32 Z = 0 ; Z < DataSize.Z ; ++Z )
+	{
+		for ( int32 Y = 0 ; Y < DataSize.Y ; ++Y )
+		{
+			const int32 DataRowIndex     = ULFPGridLibrary::ToGridIndex ( FIntVector ( 0 , Y , Z ) , DataSize );
+			const int32 SnapshotRowIndex = ULFPGridLibrary::ToGridIndex ( FIntVector ( 1 , Y + 1 , Z + 1 ) , OutSnapshot.Size );
+
+			for ( int32 X = 0 ; X < DataSize.X ; ++X )
+			{
+				OutSnapshot.PaletteIndexList [ SnapshotRowIndex + X ] = OutSnapshot.Palette.FindOrAdd ( DataComponent->GetCellTag ( RegionIndex , ChunkIndex , DataRowIndex + X ) );
+			}
+		}
+	}
+
+	// Only the apron shell need to resolve neighbour chunk
+	for ( int32 Z = 0 ; Z < OutSnapshot.Size.Z ; ++Z )
+	{
+		for ( int32 Y = 0 ; Y < OutSnapshot.Size.Y ; ++Y )
+		{
+			const bool bIsShellRow = Z == 0 || Y == 0 || Z == OutSnapshot.Size.Z - 1 || Y == OutSnapshot.Size.Y - 1;
+
+			for ( int32 X = 0 ; X < OutSnapshot.Size.X ; X += bIsShellRow ? 1 : OutSnapshot.Size.X - 1 )
+			{
+				const FIntVector CheckOffset = FIntVector ( X , Y , Z ) - FIntVector ( 1 );
+				const FIntVector CheckIndex  = PositionComponent->AddOffsetToDataGridIndex ( FIntVector ( RegionIndex , ChunkIndex , 0 ) , CheckOffset );
+
+				if ( RegionIndex != CheckIndex.X && PositionComponent->IsIsolateRegion ( ) )
+				{
+					continue;
+				}
+
+				if ( ChunkIndex != CheckIndex.Y && PositionComponent->IsIsolateChunk ( ) )
+				{
+					continue;
+				}
+
+				if ( CheckIndex.GetMin ( ) == INDEX_NONE )
+				{
+					continue;
+				}
+
+				OutSnapshot.PaletteIndexList [ ULFPGridLibrary::ToGridIndex ( FIntVector ( X , Y , Z ) , OutSnapshot.Size ) ] = OutSnapshot.Palette.FindOrAdd ( DataComponent->GetCellTag ( CheckIndex.X , CheckIndex.Y , CheckIndex.Z ) );
+			}
+		}
+	}
+}
+
+void ULPPMarchingMeshComponent::PatchCellSnapshot ( FLPPMarchingCellSnapshot& Snapshot , const TSet < int32 >& DirtyDataIndexSet ) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE ( MarchingMesh_PatchCellSnapshot );
+
+	const FIntVector DataSize = GetDataSize ( );
+
+	for ( const int32 DataIndex : DirtyDataIndexSet )
+	{
+		// Edge neighbour edit arrive as the cell next to it, so the apron cell around is recapture too
+		const FIntVector SnapshotLocation = ULFPGridLibrary::ToGridLocation ( DataIndex , DataSize ) + FIntVector ( 1 );
+
+		for ( int32 Z = SnapshotLocation.Z - 1 ; Z <= SnapshotLocation.Z + 1 ; ++Z )
+		{
+			for ( int32 Y = SnapshotLocation.Y - 1 ; Y <= SnapshotLocation.Y + 1 ; ++Y )
+			{
+				for ( int32 X = SnapshotLocation.X - 1 ; X <= SnapshotLocation.X + 1 ; ++X )
+				{
+					const FIntVector CheckIndex = PositionComponent->AddOffsetToDataGridIndex ( FIntVector ( RegionIndex , ChunkIndex , 0 ) , FIntVector ( X , Y , Z ) - FIntVector ( 1 ) );
+
+					// Same rule as CaptureCellSnapshot, unresolved cell is palette entry 0
+					const bool bIsResolved = CheckIndex.GetMin ( ) != INDEX_NONE &&
+						( RegionIndex == CheckIndex.X || PositionComponent->IsIsolateRegion ( ) == false ) &&
+						( ChunkIndex == CheckIndex.Y || PositionComponent->IsIsolateChunk ( ) == false );
+
+					Snapshot.PaletteIndexList [ ULFPGridLibrary::ToGridIndex ( FIntVector ( X , Y , Z ) , Snapshot.Size ) ] = bIsResolved ? Snapshot.Palette.FindOrAdd ( DataComponent->GetCellTag ( CheckIndex.X , CheckIndex.Y , CheckIndex.Z ) ) : 0;
+				}
+			}
+		}
+	}
+}
+
 void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 {
 	if ( bGenerateDistanceField == false )
@@ -377,7 +1926,7 @@ void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 	{
 		FScopeLock Lock ( &RenderDataLock );
 
-		if ( DistanceFieldResolutionScale <= 0.0f || MeshRenderData.IsValid ( ) == false || MeshRenderData->MeshData->TriangleCount ( ) == 0 || IsDataComponentValid ( ) == false )
+		if ( DistanceFieldResolutionScale <= 0.0f || MeshRenderData.IsValid ( ) == false || MeshRenderData->GetTriangleCount ( ) == 0 || IsDataComponentValid ( ) == false )
 		{
 			DistanceFieldComputeData.CancelJob ( );
 
@@ -406,15 +1955,10 @@ void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 
 	GetWorld ( )->GetTimerManager ( ).ClearTimer ( DistanceFieldBatchHandler );
 
-	// For safety, run the distance field compute on a (geometry-only) copy of the mesh
-	FDynamicMesh3 GeoOnlyCopy;
-
 	// Compute whether the mesh uses mainly two-sided materials before, as this is the only info the distance field compute needs from the mesh attributes
 	bool bMostlyTwoSided = bTwoSideDistanceField || IsValid ( GetMaterial ( 0 ) ) ? GetMaterial ( 0 )->IsTwoSided ( ) : false;
 
-	GeoOnlyCopy.Copy ( *MeshRenderData->MeshData.Get ( ) , false , false , false , false );
-
-	GetWorld ( )->GetTimerManager ( ).SetTimer ( DistanceFieldBatchHandler , [this , GeoOnlyCopy , bMostlyTwoSided] ( ) mutable
+	GetWorld ( )->GetTimerManager ( ).SetTimer ( DistanceFieldBatchHandler , [this , bMostlyTwoSided] ( )
 	{
 		if ( IsValid ( this ) == false )
 		{
@@ -426,10 +1970,16 @@ void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 			return;
 		}
 
+		// For safety, run the distance field compute on a (geometry-only) copy of the mesh
+		const TSharedPtr < FDynamicMesh3 > GeoOnlyCopy = MakeShared < FDynamicMesh3 > ( );
+
+		// Stream mesh only copy its position and index here, worker append it so game thread never build a welded mesh
+		TSharedPtr < FLPPDynamicMeshStreamData > SourceStream = nullptr;
+
 		{
 			FScopeLock Lock ( &RenderDataLock );
 
-			if ( DistanceFieldResolutionScale <= 0.0f || MeshRenderData.IsValid ( ) == false || MeshRenderData->MeshData->TriangleCount ( ) == 0 || IsDataComponentValid ( ) == false )
+			if ( DistanceFieldResolutionScale <= 0.0f || MeshRenderData.IsValid ( ) == false || MeshRenderData->GetTriangleCount ( ) == 0 || IsDataComponentValid ( ) == false )
 			{
 				DistanceFieldComputeData.CancelJob ( );
 
@@ -440,6 +1990,18 @@ void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 
 				return;
 			}
+
+			if ( MeshRenderData->HasStreamData ( ) )
+			{
+				SourceStream = MakeShared < FLPPDynamicMeshStreamData > ( );
+
+				SourceStream->PositionList = MeshRenderData->StreamData->PositionList;
+				SourceStream->IndexList    = MeshRenderData->StreamData->IndexList;
+			}
+			else if ( MeshRenderData->MeshData.IsValid ( ) )
+			{
+				GeoOnlyCopy->Copy ( *MeshRenderData->MeshData , false , false , false , false );
+			}
 		}
 
 		OnDistanceFieldRebuilding.Broadcast ( this );
@@ -480,11 +2042,35 @@ void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 					{
 						const FVector& FaceVertexPos = FaceVertexPosList [ FaceIndex ] [ FaceVertexIndex ] - MeshBoundHalfSize;
 
-						FaceVertexIndexList [ FaceVertexIndex ] = GeoOnlyCopy.AppendVertex ( FaceVertexPos );
-					}
+						FaceVertexIndexList [ FaceVertexIndex ] = GeoOnlyCopy->AppendVertex ( FaceVertexPos );
+					}
+
+					GeoOnlyCopy->AppendTriangle ( FaceVertexIndexList );
+				}
+			};
+
+			FLPPMarchingTagPalette TagPalette;
+			TArray < int32 >       LayerLookup;
+			TArray < FGameplayTag > HandleTagList;
+
+			{
+				TArray < FLPPMarchingLayerSetting > LayerSettingList;
+
+				GetLayerSettingList ( LayerSettingList );
+
+				for ( const FLPPMarchingLayerSetting& LayerSetting : LayerSettingList )
+				{
+					HandleTagList.Add ( LayerSetting.HandleTag );
+				}
+			}
+
+			const auto IsSolidTag = [&] ( const FGameplayTag& CellTag )
+			{
+				const uint16 PaletteIndex = TagPalette.FindOrAdd ( CellTag );
 
-					GeoOnlyCopy.AppendTriangle ( FaceVertexIndexList );
-				}
+				TagPalette.UpdateLayerLookup ( LayerLookup , HandleTagList );
+
+				return LayerLookup [ PaletteIndex ] != INDEX_NONE;
 			};
 
 			/* Generate Voxel Mesh Data */
@@ -495,7 +2081,7 @@ void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 
 				const FGameplayTag& SelfVoxelTag = DataComponent->GetCellTag ( VoxelDataIndex.X , VoxelDataIndex.Y , VoxelDataIndex.Z );
 
-				if ( SelfVoxelTag.MatchesTag ( HandleTag ) )
+				if ( IsSolidTag ( SelfVoxelTag ) )
 				{
 					for ( int32 FaceDirectionIndex = 0 ; FaceDirectionIndex < 6 ; ++FaceDirectionIndex )
 					{
@@ -503,7 +2089,7 @@ void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 
 						const bool bForceRender = ULFPGridLibrary::IsGridLocationValid ( VoxelPos + LFPMarchingRenderConstantData::FaceDirection [ FaceDirectionIndex ].Up , DataSize ) == false;
 
-						const bool TargetVoxelValid = TargetIndex.GetMin ( ) != INDEX_NONE && DataComponent->GetCellTag ( TargetIndex.X , TargetIndex.Y , TargetIndex.Z ).MatchesTag ( HandleTag );
+						const bool TargetVoxelValid = TargetIndex.GetMin ( ) != INDEX_NONE && IsSolidTag ( DataComponent->GetCellTag ( TargetIndex.X , TargetIndex.Y , TargetIndex.Z ) );
 
 						// Check Is Border
 						if ( bForceRender && TargetVoxelValid )
@@ -518,11 +2104,16 @@ void ULPPMarchingMeshComponent::UpdateDistanceField ( )
 		const float CurrentDistanceFieldResolutionScale = DistanceFieldResolutionScale;
 
 		DistanceFieldComputeData.LaunchJob ( TEXT ( "MarchingDynamicMeshComponentDistanceField" ) ,
-		                                     [this,GeoOnlyCopy , CurrentDistanceFieldResolutionScale, bMostlyTwoSided] ( FProgressCancel& Progress , TQueue < TFunction < void  ( ) > , EQueueMode::Mpsc >& GameThreadJob )
+		                                     [this,GeoOnlyCopy , SourceStream , CurrentDistanceFieldResolutionScale, bMostlyTwoSided] ( FProgressCancel& Progress , TQueue < TFunction < void  ( ) > , EQueueMode::Mpsc >& GameThreadJob )
 		                                     {
+			                                     if ( SourceStream.IsValid ( ) )
+			                                     {
+				                                     SourceStream->AppendGeometryToDynamicMesh ( *GeoOnlyCopy );
+			                                     }
+
 			                                     TUniquePtr < FDistanceFieldVolumeData > ThreadData = MakeUnique < FDistanceFieldVolumeData > ( );
 
-			                                     ULPPDynamicMeshLibrary::BuildDynamicMeshDistanceField ( *ThreadData.Get ( ) , Progress , GeoOnlyCopy , bMostlyTwoSided , CurrentDistanceFieldResolutionScale );
+			                                     ULPPDynamicMeshLibrary::BuildDynamicMeshDistanceField ( *ThreadData.Get ( ) , Progress , *GeoOnlyCopy , bMostlyTwoSided , CurrentDistanceFieldResolutionScale );
 
 			                                     if ( Progress.Cancelled ( ) == false )
 			                                     {
@@ -546,7 +2137,7 @@ void ULPPMarchingMeshComponent::NotifyMeshUpdated ( )
 	UpdateDistanceField ( );
 }
 
-void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction ( TUniquePtr < FLFPMarchingThreadData >& ThreadData , FProgressCancel& Progress , const TBitArray < >& SolidList , const FLFPMarchingPassData& PassData )
+void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction ( TUniquePtr < FLFPMarchingThreadData >& ThreadData , FProgressCancel& Progress , const FLPPMarchingCellSnapshot& CellSnapshot , const FLFPMarchingPassData& PassData )
 {
 	if ( Progress.Cancelled ( ) )
 	{
@@ -555,6 +2146,8 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction ( TUniquePtr
 
 	TRACE_CPUPROFILER_EVENT_SCOPE ( MarchingMesh_GeneratingThreadData );
 
+	FLPPMarchingStageTiming::FScope TotalTimer ( ThreadData->StageTiming.Total );
+
 	FDateTime WorkTime    = FDateTime::UtcNow ( );
 	ThreadData->StartTime = PassData.StartTime;
 	ThreadData->DataID    = PassData.DataID;
@@ -562,168 +2155,686 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction ( TUniquePtr
 	const FVector& MeshFullSize = PassData.MeshFullSize;
 	const FVector  MeshGapSize  = MeshFullSize;
 
-	const FIntVector& DataSize      = PassData.DataSize;
-	const FIntVector& CacheDataSize = DataSize + FIntVector ( 2 );
+	const FIntVector& DataSize = PassData.DataSize;
 
 	const FVector MeshBoundFullSize = MeshGapSize * FVector ( DataSize );
 	const FVector MeshBoundHalfSize = MeshBoundFullSize * FVector ( 0.5 );
 
-	const FIntVector MarchingSize = DataSize + FIntVector ( 1 );
+	// Render mesh run on the LOD grid, Lumen card and collision stay on the full grid
+	const int32      LODStep      = 1 << PassData.LODIndex;
+	const FIntVector MeshDataSize = FIntVector ( DataSize.X / LODStep , DataSize.Y / LODStep , DataSize.Z / LODStep );
+	const FVector    MeshCellSize = MeshGapSize * LODStep;
+
+	const FIntVector MarchingSize = MeshDataSize + FIntVector ( 1 );
 	const int32      MarchingNum  = MarchingSize.X * MarchingSize.Y * MarchingSize.Z;
 
 	const FBox CurrentLocalBounds = FBox ( -MeshBoundHalfSize , MeshBoundHalfSize );
 
 	const float BoundExpand = PassData.BoundExpand;
 
-	const auto GetMarchingID = [&] ( const FIntVector& StartPosition )
+	// Union of every layer, use by Lumen card and collision
+	FLPPMarchingSolidCache& SolidList = ThreadData->SolidCache;
+
+	TArray < FLPPMarchingSolidCache >& LayerSolidList = ThreadData->LayerSolidCacheList;
+
+	SolidList.Init ( CellSnapshot.Size );
 	{
-		uint8 MarchingID = 0;
+		TRACE_CPUPROFILER_EVENT_SCOPE ( MarchingMesh_ClassifySolid );
 
-		for ( int32 MarchingIndex = 0 ; MarchingIndex < 8 ; ++MarchingIndex )
+		FLPPMarchingStageTiming::FScope StageTimer ( ThreadData->StageTiming.Classify );
+
+		int32 ValidCount = 0;
+
+		TArray < FGameplayTag > HandleTagList;
+
+		for ( const FLPPMarchingLayerSetting& LayerSetting : PassData.LayerList )
+		{
+			HandleTagList.Add ( LayerSetting.HandleTag );
+		}
+
+		TArray < int32 > LayerLookup;
+
+		CellSnapshot.Palette.UpdateLayerLookup ( LayerLookup , HandleTagList );
+
+		LayerSolidList.SetNum ( PassData.LayerList.Num ( ) );
+
+		for ( FLPPMarchingSolidCache& LayerSolid : LayerSolidList )
 		{
-			const FIntVector MarchingPosition = ULFPGridLibrary::ToGridLocation ( MarchingIndex , FIntVector ( 2 ) ) + StartPosition;
-			const int32      SolidIndex       = ULFPGridLibrary::ToGridIndex ( MarchingPosition , DataSize + FIntVector ( 2 ) );
+			LayerSolid.Init ( CellSnapshot.Size );
+		}
 
-			if ( SolidList [ SolidIndex ] )
+		int32 SolidIndex = 0;
+
+		for ( int32 Z = 0 ; Z < CellSnapshot.Size.Z ; ++Z )
+		{
+			for ( int32 Y = 0 ; Y < CellSnapshot.Size.Y ; ++Y )
 			{
-				MarchingID |= 1 << MarchingIndex;
+				for ( int32 X = 0 ; X < CellSnapshot.Size.X ; ++X , ++SolidIndex )
+				{
+					if ( const int32 LayerIndex = LayerLookup [ CellSnapshot.PaletteIndexList [ SolidIndex ] ] ; LayerIndex != INDEX_NONE )
+					{
+						SolidList.Set ( X , Y , Z );
+						LayerSolidList [ LayerIndex ].Set ( X , Y , Z );
+
+						ValidCount += 1;
+					}
+				}
 			}
 		}
 
-		return MarchingID;
-	};
+		// Complete Empty No Need Render Or Inside Other Chunk So Don't Need To Render
+		if ( ValidCount == 0 || ValidCount == SolidList.Num ( ) )
+		{
+			ThreadData->bIsSkipOnEmpty = ValidCount == 0;
+			ThreadData->bIsSkipOnFull  = ValidCount != 0;
+
+			return;
+		}
+	}
 
 	if ( Progress.Cancelled ( ) )
 	{
 		return;
 	}
 
+	if ( PassData.bRenderData && PassData.LODIndex > 0 )
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE ( MarchingMesh_DownsampleSolid );
+
+		FLPPMarchingStageTiming::FScope StageTimer ( ThreadData->StageTiming.Classify );
+
+		ThreadData->LODSolidCache.InitDownsample ( SolidList , LODStep , PassData.LODReduction );
+
+		ThreadData->LODLayerSolidCacheList.SetNum ( LayerSolidList.Num ( ) );
+
+		for ( int32 LayerIndex = 0 ; LayerIndex < LayerSolidList.Num ( ) ; ++LayerIndex )
+		{
+			ThreadData->LODLayerSolidCacheList [ LayerIndex ].InitDownsample ( LayerSolidList [ LayerIndex ] , LODStep , PassData.LODReduction );
+		}
+	}
+
+	// Point to the full grid on LOD 0
+	const FLPPMarchingSolidCache&            MeshSolidList      = PassData.LODIndex > 0 ? ThreadData->LODSolidCache : SolidList;
+	const TArray < FLPPMarchingSolidCache >& MeshLayerSolidList = PassData.LODIndex > 0 ? ThreadData->LODLayerSolidCacheList : LayerSolidList;
+
 	// Mesh Data
 	if ( PassData.bRenderData )
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE ( MarchingMesh_GeneratingMesh );
 
+		FLPPMarchingStageTiming::FScope StageTimer ( ThreadData->StageTiming.Mesh );
+
 		FDynamicMesh3* MeshData = &ThreadData->MeshData;
 		{
 			MeshData->Clear ( );
 			MeshData->EnableAttributes ( );
 			MeshData->Attributes ( )->EnableMaterialID ( );
+
+			ThreadData->StreamData.Reset ( );
 		}
 
 		bool bHasMesh = false;
 
-		TArray < uint8 > MarchingIDList;
+		const int32 LayerNum = PassData.LayerList.Num ( );
+
+		// Layer after layer, each MarchingNum long
+		TArray < uint8 >& MarchingIDList = ThreadData->MarchingIDList;
 		{
-			MarchingIDList.SetNum ( MarchingNum );
+			FLPPMarchingStageTiming::FScope MarchingIDTimer ( ThreadData->StageTiming.MarchingID );
+
+			MarchingIDList.SetNumUninitialized ( MarchingNum * LayerNum );
 
-			for ( int32 MarchingIndex = 0 ; MarchingIndex < MarchingNum ; ++MarchingIndex )
+			// Corner bit follow ToGridLocation ( Index , FIntVector ( 2 ) ) so bit 0 is X , bit 1 is Y , bit 2 is Z
+			const uint64* CornerRowList [ 4 ];
+			uint64        CornerWordList [ 8 ];
+
+			for ( int32 LayerIndex = 0 ; LayerIndex < LayerNum ; ++LayerIndex )
 			{
-				const FIntVector CheckPos = ULFPGridLibrary::ToGridLocation ( MarchingIndex , MarchingSize );
+				const FLPPMarchingSolidCache& LayerSolid = MeshLayerSolidList [ LayerIndex ];
+
+				for ( int32 Z = 0 ; Z < MarchingSize.Z ; ++Z )
+				{
+					for ( int32 Y = 0 ; Y < MarchingSize.Y ; ++Y )
+					{
+						for ( int32 CornerIndex = 0 ; CornerIndex < 4 ; ++CornerIndex )
+						{
+							CornerRowList [ CornerIndex ] = LayerSolid.GetRow ( Y + ( CornerIndex & 1 ) , Z + ( CornerIndex >> 1 ) );
+						}
+
+						uint8* MarchingIDRow = MarchingIDList.GetData ( ) + ( LayerIndex * MarchingNum ) + ( ( Y + ( Z * MarchingSize.Y ) ) * MarchingSize.X );
+
+						for ( int32 StartX = 0 ; StartX < MarchingSize.X ; StartX += 64 )
+						{
+							const int32  CellCount = FMath::Min ( MarchingSize.X - StartX , 64 );
+							const uint64 CellMask  = CellCount == 64 ? ~uint64 ( 0 ) : ( uint64 ( 1 ) << CellCount ) - 1;
+
+							uint64 AnyMask = 0;
+							uint64 AllMask = CellMask;
+
+							for ( int32 CornerIndex = 0 ; CornerIndex < 8 ; ++CornerIndex )
+							{
+								CornerWordList [ CornerIndex ] = LayerSolid.GetWord ( CornerRowList [ CornerIndex >> 1 ] , StartX + ( CornerIndex & 1 ) ) & CellMask;
 
-				MarchingIDList [ MarchingIndex ] = GetMarchingID ( CheckPos );
+								AnyMask |= CornerWordList [ CornerIndex ];
+								AllMask &= CornerWordList [ CornerIndex ];
+							}
+
+							// Whole word is empty or full, no per cell work needed
+							if ( AnyMask == 0 || AllMask == CellMask )
+							{
+								FMemory::Memset ( MarchingIDRow + StartX , AnyMask == 0 ? 0 : 255 , CellCount );
+
+								continue;
+							}
+
+							bHasMesh = true;
+
+							for ( int32 CellIndex = 0 ; CellIndex < CellCount ; ++CellIndex )
+							{
+								uint8 MarchingID = 0;
 
-				bHasMesh |= MarchingIDList [ MarchingIndex ] != 0 && MarchingIDList [ MarchingIndex ] != 255;
+								for ( int32 CornerIndex = 0 ; CornerIndex < 8 ; ++CornerIndex )
+								{
+									MarchingID |= ( ( CornerWordList [ CornerIndex ] >> CellIndex ) & 1 ) << CornerIndex;
+								}
+
+								MarchingIDRow [ StartX + CellIndex ] = MarchingID;
+							}
+						}
+					}
+				}
 			}
 		}
 
 		if ( bHasMesh )
 		{
-			const TObjectPtr < ULPPMarchingData >& MeshAsset = PassData.RenderSetting;
+			// Only cell on the chunk edge stick out of the chunk bound, interior cell never need clipping
+			const auto IsBoundaryCell = [&] ( const FIntVector& GridLocation )
+			{
+				return GridLocation.GetMin ( ) == 0 ||
+					GridLocation.X == MarchingSize.X - 1 ||
+					GridLocation.Y == MarchingSize.Y - 1 ||
+					GridLocation.Z == MarchingSize.Z - 1;
+			};
 
-			UE::Geometry::FDynamicMeshEditor Editor ( MeshData );
+			// Box uv only depend on position and face normal, so it is write while the vertex is emit
+			const LPPMarchingStreamMesher::FBoxUVProjector  BoxUVProjectorData ( PassData.UVBoxTransform );
+			const LPPMarchingStreamMesher::FBoxUVProjector* BoxUVProjector = PassData.bRecomputeBoxUV ? &BoxUVProjectorData : nullptr;
 
-			/* Generate Marching Mesh Data */
-			for ( int32 MarchingIndex = 0 ; MarchingIndex < MarchingNum ; ++MarchingIndex )
+			if ( PassData.MesherType == ELPPMarchingMesherType::VertexStream )
 			{
-				const FIntVector MarchingGridLocation = ULFPGridLibrary::ToGridLocation ( MarchingIndex , MarchingSize );
-				const FVector    MarchingMeshLocation = ( MeshGapSize * FVector ( MarchingGridLocation ) ) - MeshBoundHalfSize;
-				const uint8      MarchingID           = MarchingIDList [ MarchingIndex ];
+				FLPPDynamicMeshStreamData& StreamData = ThreadData->StreamData;
+
+				FLPPMarchingStreamBlockCache& BlockCache = *PassData.StreamBlockCache;
+
+				const int32      BlockSize  = FMath::Max ( PassData.SubBlockSize , 1 );
+				const FIntVector BlockCount = FIntVector (
+				                                          FMath::DivideAndRoundUp ( MarchingSize.X , BlockSize ) ,
+				                                          FMath::DivideAndRoundUp ( MarchingSize.Y , BlockSize ) ,
+				                                          FMath::DivideAndRoundUp ( MarchingSize.Z , BlockSize )
+				                                         );
+				const int32 BlockNum = BlockCount.X * BlockCount.Y * BlockCount.Z;
+
+				// Cache entry is ( LayerIndex * BlockNum ) + BlockIndex
+				const int32 EntryNum = BlockNum * LayerNum;
+
+				TArray < int32 > DirtyBlockList;
+
+				if ( PassData.bIsFullRebuild || BlockCache.bIsValid == false || BlockCache.BlockCount != BlockCount || BlockCache.BlockSize != BlockSize || BlockCache.BlockList.Num ( ) != EntryNum )
+				{
+					BlockCache.BlockCount = BlockCount;
+					BlockCache.BlockSize  = BlockSize;
+
+					BlockCache.BlockList.Reset ( );
+					BlockCache.BlockList.SetNum ( EntryNum );
+
+					for ( int32 EntryIndex = 0 ; EntryIndex < EntryNum ; ++EntryIndex )
+					{
+						DirtyBlockList.Add ( EntryIndex );
+					}
+				}
+				else
+				{
+					// Lumen card and collision is skip when the edit only swap one solid tag for another
+					ThreadData->bIsSolidUnchanged = BlockCache.SolidCache.IsSame ( SolidList );
+
+					// Cell change can move surface between layer so dirty block is rebuild on every layer
+					for ( const int32 BlockIndex : PassData.DirtyBlockList )
+					{
+						if ( BlockIndex < 0 || BlockIndex >= BlockNum )
+						{
+							continue;
+						}
+
+						for ( int32 LayerIndex = 0 ; LayerIndex < LayerNum ; ++LayerIndex )
+						{
+							DirtyBlockList.Add ( ( LayerIndex * BlockNum ) + BlockIndex );
+						}
+					}
+				}
+
+				// Stay invalid until every dirty block is write, a cancel will force a full rebuild next time
+				BlockCache.bIsValid = false;
+
+				ParallelFor ( DirtyBlockList.Num ( ) , [&] ( const int32 DirtyIndex )
+				{
+					const int32      EntryIndex    = DirtyBlockList [ DirtyIndex ];
+					const int32      LayerIndex    = EntryIndex / BlockNum;
+					const int32      BlockIndex    = EntryIndex % BlockNum;
+					const FIntVector BlockStart    = ULFPGridLibrary::ToGridLocation ( BlockIndex , BlockCount ) * BlockSize;
+					const FIntVector BlockEnd      = FIntVector ( FMath::Min ( BlockStart.X + BlockSize , MarchingSize.X ) , FMath::Min ( BlockStart.Y + BlockSize , MarchingSize.Y ) , FMath::Min ( BlockStart.Z + BlockSize , MarchingSize.Z ) );
+
+					const FLPPMarchingLayerSetting& LayerSetting = PassData.LayerList [ LayerIndex ];
+					const ULPPMarchingData*         MeshAsset    = LayerSetting.RenderSetting.Get ( );
+					const uint8*                    LayerIDList  = MarchingIDList.GetData ( ) + ( LayerIndex * MarchingNum );
+
+					LPPMarchingStreamMesher::FStreamWriter StreamWriter ( BlockCache.BlockList [ EntryIndex ] , PassData.EdgeMergeDistance );
+
+					TArray < LPPMarchingStreamMesher::FClipVertex > ClipPolygon;
+					TArray < LPPMarchingStreamMesher::FClipVertex > ClipScratch;
+
+					for ( int32 Z = BlockStart.Z ; Z < BlockEnd.Z ; ++Z )
+					{
+						if ( Progress.Cancelled ( ) )
+						{
+							return;
+						}
+
+						for ( int32 Y = BlockStart.Y ; Y < BlockEnd.Y ; ++Y )
+						{
+							for ( int32 X = BlockStart.X ; X < BlockEnd.X ; ++X )
+							{
+								const FIntVector MarchingGridLocation = FIntVector ( X , Y , Z );
+
+								const FLPPMarchingBakedTile* BakedTile = MeshAsset->GetBakedTile ( LayerIDList [ ULFPGridLibrary::ToGridIndex ( MarchingGridLocation , MarchingSize ) ] );
+
+								if ( BakedTile == nullptr )
+								{
+									continue;
+								}
+
+								const FVector3f MarchingMeshLocation = FVector3f ( ( MeshCellSize * FVector ( MarchingGridLocation ) ) - MeshBoundHalfSize );
+
+								const bool bIsBoundaryCell = IsBoundaryCell ( MarchingGridLocation );
+
+								StreamWriter.bIsSeam = X == BlockStart.X || Y == BlockStart.Y || Z == BlockStart.Z || X == BlockEnd.X - 1 || Y == BlockEnd.Y - 1 || Z == BlockEnd.Z - 1;
+
+								for ( int32 TriangleIndex = 0 ; TriangleIndex < BakedTile->TriangleList.Num ( ) ; ++TriangleIndex )
+								{
+									LPPMarchingStreamMesher::BuildTilePolygon ( ClipPolygon , *BakedTile , TriangleIndex , MarchingMeshLocation , LODStep );
+
+									// Face is pick before clip so clipped piece keep the same projection
+									const int32 UVFaceIndex = BoxUVProjector != nullptr ? BoxUVProjector->GetFaceIndex ( UE::Geometry::VectorUtil::Normal ( ClipPolygon [ 0 ].Position , ClipPolygon [ 1 ].Position , ClipPolygon [ 2 ].Position ) ) : INDEX_NONE;
+
+									if ( bIsBoundaryCell )
+									{
+										LPPMarchingStreamMesher::ClipPolygonByBox ( ClipPolygon , ClipScratch , FVector3f ( MeshBoundHalfSize ) );
+									}
+
+									if ( BoxUVProjector != nullptr )
+									{
+										BoxUVProjector->SetPolygonUV ( ClipPolygon , UVFaceIndex );
+									}
+
+									StreamWriter.AddPolygon ( ClipPolygon , static_cast < uint8 > ( BakedTile->MaterialIDList [ TriangleIndex ] + LayerSetting.MaterialOffset ) );
+								}
+							}
+						}
+					}
+				} , EParallelForFlags::Unbalanced );
 
 				if ( Progress.Cancelled ( ) )
 				{
 					return;
 				}
 
-				if ( const FLFPMarchingMeshMappingDataV2& MeshMappingData = MeshAsset->GetMappingData ( MarchingID ) ; MeshMappingData.MeshID != INDEX_NONE )
+				BlockCache.bIsValid   = true;
+				BlockCache.SolidCache = SolidList;
+
+				LPPMarchingStreamMesher::MergeBlockList ( StreamData , ThreadData->StreamBorderList , BlockCache.BlockList , PassData.EdgeMergeDistance );
+
+				// Only vertex on a welded tile border need fix up, the rest already carry the baked normal
+				LPPMarchingStreamMesher::SmoothBorderNormal ( StreamData , ThreadData->StreamBorderList , PassData.EdgeMergeDistance , PassData.SeamNormalAngle );
+
+				// These operation only exist on dynamic mesh
+				if ( PassData.bSimplifyRenderData )
+				{
+					StreamData.ToDynamicMesh ( *MeshData );
+					StreamData.Reset ( );
+				}
+			}
+			else if ( PassData.MesherType == ELPPMarchingMesherType::SurfaceNets )
+			{
+				FLPPDynamicMeshStreamData& StreamData = ThreadData->StreamData;
+
+				for ( int32 LayerIndex = 0 ; LayerIndex < LayerNum ; ++LayerIndex )
+				{
+					if ( Progress.Cancelled ( ) )
+					{
+						return;
+					}
+
+					LPPMarchingStreamMesher::BuildSurfaceNets (
+					                                           StreamData ,
+					                                           ThreadData->SurfaceVertexList ,
+					                                           MarchingIDList.GetData ( ) + ( LayerIndex * MarchingNum ) ,
+					                                           MarchingSize ,
+					                                           FVector3f ( MeshCellSize ) ,
+					                                           FVector3f ( MeshBoundHalfSize ) ,
+					                                           static_cast < uint8 > ( PassData.LayerList [ LayerIndex ].MaterialOffset ) ,
+					                                           BoxUVProjector
+					                                          );
+				}
+
+				if ( PassData.bSimplifyRenderData )
+				{
+					StreamData.ToDynamicMesh ( *MeshData );
+					StreamData.Reset ( );
+				}
+			}
+			else if ( PassData.MesherType == ELPPMarchingMesherType::GreedyBlocky )
+			{
+				FLPPDynamicMeshStreamData& StreamData = ThreadData->StreamData;
+
+				LPPMarchingStreamMesher::BuildGreedyMesh (
+				                                          StreamData ,
+				                                          ThreadData->GreedyFaceMask ,
+				                                          MeshSolidList ,
+				                                          MeshLayerSolidList ,
+				                                          PassData.LayerList ,
+				                                          MeshDataSize ,
+				                                          FVector3f ( MeshCellSize ) ,
+				                                          FVector3f ( MeshBoundHalfSize ) ,
+				                                          BoxUVProjector
+				                                         );
+
+				if ( PassData.bSimplifyRenderData )
+				{
+					StreamData.ToDynamicMesh ( *MeshData );
+					StreamData.Reset ( );
+				}
+			}
+			else
+			{
+				FDynamicMeshNormalOverlay*     NormalOverlay     = MeshData->Attributes ( )->PrimaryNormals ( );
+				FDynamicMeshUVOverlay*         UVOverlay         = MeshData->Attributes ( )->PrimaryUV ( );
+				FDynamicMeshMaterialAttribute* MaterialAttribute = MeshData->Attributes ( )->GetMaterialID ( );
+
+				TArray < int32 > VertexIDList;
+				TArray < int32 > NormalIDList;
+				TArray < int32 > UVIDList;
+
+				const float InvWeldDistance = 1.0f / FMath::Max ( PassData.EdgeMergeDistance , UE_KINDA_SMALL_NUMBER );
+
+				TMap < FIntVector , int32 >& WeldVertexMap = ThreadData->WeldVertexMap;
+
+				WeldVertexMap.Reset ( );
+
+				// Border normal of tile meeting on one weld vertex share an element, normal is finalize after every tile is add
+				const float BorderMinDot = FMath::Cos ( FMath::DegreesToRadians ( PassData.SeamNormalAngle ) );
+
+				TMap < int32 , TArray < LPPMarchingStreamMesher::FBorderNormalElement , TInlineAllocator < 4 > > > BorderNormalMap;
+
+				const auto GetNormalElementID = [&] ( const int32 VertexID , const FVector3f& Normal , const bool bIsBorder )
+				{
+					if ( bIsBorder == false )
+					{
+						return NormalOverlay->AppendElement ( Normal );
+					}
+
+					auto& ElementList = BorderNormalMap.FindOrAdd ( VertexID );
+
+					for ( LPPMarchingStreamMesher::FBorderNormalElement& Element : ElementList )
+					{
+						if ( ( Element.Normal | Normal ) >= BorderMinDot )
+						{
+							Element.NormalSum += Normal;
+
+							return Element.ElementID;
+						}
+					}
+
+					LPPMarchingStreamMesher::FBorderNormalElement& NewElement = ElementList.AddDefaulted_GetRef ( );
+
+					NewElement.ElementID = NormalOverlay->AppendElement ( Normal );
+					NewElement.Normal    = Normal;
+					NewElement.NormalSum = Normal;
+
+					return NewElement.ElementID;
+				};
+
+				// Weld vertex share one uv element per projection face, hard seam only where face change
+				TMap < FIntPoint , int32 > BoxUVElementMap;
+
+				const auto GetBoxUVElementID = [&] ( const int32 VertexID , const int32 FaceIndex )
+				{
+					const FIntPoint ElementKey = FIntPoint ( VertexID , FaceIndex );
+
+					if ( const int32* ElementIDPtr = BoxUVElementMap.Find ( ElementKey ) ; ElementIDPtr != nullptr )
+					{
+						return *ElementIDPtr;
+					}
+
+					return BoxUVElementMap.Add ( ElementKey , UVOverlay->AppendElement ( BoxUVProjector->GetUV ( FVector3f ( MeshData->GetVertex ( VertexID ) ) , FaceIndex ) ) );
+				};
+
+				const auto SetBoxUVTriangle = [&] ( const int32 TriangleID )
+				{
+					const UE::Geometry::FIndex3i Triangle  = MeshData->GetTriangle ( TriangleID );
+					const int32                  FaceIndex = BoxUVProjector->GetFaceIndex ( FVector3f ( MeshData->GetTriNormal ( TriangleID ) ) );
+
+					UVOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( GetBoxUVElementID ( Triangle.A , FaceIndex ) , GetBoxUVElementID ( Triangle.B , FaceIndex ) , GetBoxUVElementID ( Triangle.C , FaceIndex ) ) );
+				};
+
+				TArray < LPPMarchingStreamMesher::FClipVertex > ClipPolygon;
+				TArray < LPPMarchingStreamMesher::FClipVertex > ClipScratch;
+
+				const auto GetWeldVertexID = [&] ( const FVector3f& VertexPosition )
+				{
+					const FIntVector VertexKey = LPPMarchingStreamMesher::ToLatticeKey ( VertexPosition , InvWeldDistance );
+
+					if ( const int32* VertexIDPtr = WeldVertexMap.Find ( VertexKey ) ; VertexIDPtr != nullptr )
+					{
+						return *VertexIDPtr;
+					}
+
+					return WeldVertexMap.Add ( VertexKey , MeshData->AppendVertex ( FVector3d ( VertexPosition ) ) );
+				};
+
+				// Weld would make edge non manifold, keep this triangle unwelded like the old edge merge did
+				const auto AppendWeldTriangle = [&] ( const FIntVector3& Triangle , const int32 GroupID )
+				{
+					const int32 TriangleID = MeshData->AppendTriangle ( Triangle.X , Triangle.Y , Triangle.Z , GroupID );
+
+					if ( TriangleID != FDynamicMesh3::NonManifoldID )
+					{
+						return TriangleID;
+					}
+
+					return MeshData->AppendTriangle (
+					                                 MeshData->AppendVertex ( MeshData->GetVertex ( Triangle.X ) ) ,
+					                                 MeshData->AppendVertex ( MeshData->GetVertex ( Triangle.Y ) ) ,
+					                                 MeshData->AppendVertex ( MeshData->GetVertex ( Triangle.Z ) ) ,
+					                                 GroupID
+					                                );
+				};
+
+				/* Generate Marching Mesh Data */
+				for ( int32 LayerMarchingIndex = 0 ; LayerMarchingIndex < MarchingNum * LayerNum ; ++LayerMarchingIndex )
 				{
-					const FDynamicMesh3* AppendMesh = MeshAsset->GetDynamicMesh ( MeshMappingData.MeshID );
+					const int32 LayerIndex    = LayerMarchingIndex / MarchingNum;
+					const int32 MarchingIndex = LayerMarchingIndex % MarchingNum;
+					const uint8 MarchingID    = MarchingIDList [ LayerMarchingIndex ];
+
+					const ULPPMarchingData* MeshAsset      = PassData.LayerList [ LayerIndex ].RenderSetting.Get ( );
+					const int32             MaterialOffset = PassData.LayerList [ LayerIndex ].MaterialOffset;
+
+					if ( Progress.Cancelled ( ) )
+					{
+						return;
+					}
+
+					// Tile is already rotated on load, only translate here
+					const FLPPMarchingBakedTile* BakedTile = MeshAsset->GetBakedTile ( MarchingID );
+
+					if ( BakedTile == nullptr )
+					{
+						continue;
+					}
+
+					const FIntVector MarchingGridLocation = ULFPGridLibrary::ToGridLocation ( MarchingIndex , MarchingSize );
+					const FVector3f  MarchingMeshLocation = FVector3f ( ( MeshCellSize * FVector ( MarchingGridLocation ) ) - MeshBoundHalfSize );
+
+					if ( IsBoundaryCell ( MarchingGridLocation ) )
+					{
+						for ( int32 TriangleIndex = 0 ; TriangleIndex < BakedTile->TriangleList.Num ( ) ; ++TriangleIndex )
+						{
+							LPPMarchingStreamMesher::BuildTilePolygon ( ClipPolygon , *BakedTile , TriangleIndex , MarchingMeshLocation , LODStep );
+							LPPMarchingStreamMesher::ClipPolygonByBox ( ClipPolygon , ClipScratch , FVector3f ( MeshBoundHalfSize ) );
+
+							if ( ClipPolygon.Num ( ) < 3 )
+							{
+								continue;
+							}
+
+							const bool bHasNormal = BakedTile->TriangleNormalList [ TriangleIndex ].X != INDEX_NONE;
+							const bool bHasUV     = BakedTile->TriangleUVList [ TriangleIndex ].X != INDEX_NONE && BoxUVProjector == nullptr;
+
+							VertexIDList.SetNumUninitialized ( ClipPolygon.Num ( ) , EAllowShrinking::No );
+							NormalIDList.SetNumUninitialized ( ClipPolygon.Num ( ) , EAllowShrinking::No );
+							UVIDList.SetNumUninitialized ( ClipPolygon.Num ( ) , EAllowShrinking::No );
+
+							for ( int32 PolygonIndex = 0 ; PolygonIndex < ClipPolygon.Num ( ) ; ++PolygonIndex )
+							{
+								VertexIDList [ PolygonIndex ] = GetWeldVertexID ( ClipPolygon [ PolygonIndex ].Position );
+								NormalIDList [ PolygonIndex ] = bHasNormal ? GetNormalElementID ( VertexIDList [ PolygonIndex ] , ClipPolygon [ PolygonIndex ].Normal , ClipPolygon [ PolygonIndex ].bIsBorder ) : INDEX_NONE;
+								UVIDList [ PolygonIndex ]     = bHasUV ? UVOverlay->AppendElement ( ClipPolygon [ PolygonIndex ].UV ) : INDEX_NONE;
+							}
+
+							for ( int32 PolygonIndex = 2 ; PolygonIndex < ClipPolygon.Num ( ) ; ++PolygonIndex )
+							{
+								const int32 TriangleID = AppendWeldTriangle ( FIntVector3 ( VertexIDList [ 0 ] , VertexIDList [ PolygonIndex - 1 ] , VertexIDList [ PolygonIndex ] ) , BakedTile->GroupIDList [ TriangleIndex ] );
+
+								if ( TriangleID < 0 )
+								{
+									continue;
+								}
+
+								if ( bHasNormal )
+								{
+									NormalOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( NormalIDList [ 0 ] , NormalIDList [ PolygonIndex - 1 ] , NormalIDList [ PolygonIndex ] ) );
+								}
+
+								if ( BoxUVProjector != nullptr )
+								{
+									SetBoxUVTriangle ( TriangleID );
+								}
+								else if ( bHasUV )
+								{
+									UVOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( UVIDList [ 0 ] , UVIDList [ PolygonIndex - 1 ] , UVIDList [ PolygonIndex ] ) );
+								}
+
+								MaterialAttribute->SetValue ( TriangleID , BakedTile->MaterialIDList [ TriangleIndex ] + MaterialOffset );
+							}
+						}
+
+						continue;
+					}
+
+					VertexIDList.SetNumUninitialized ( BakedTile->PositionList.Num ( ) , EAllowShrinking::No );
+					NormalIDList.SetNumUninitialized ( BakedTile->NormalList.Num ( ) , EAllowShrinking::No );
+					UVIDList.SetNumUninitialized ( BakedTile->UVList.Num ( ) , EAllowShrinking::No );
+
+					for ( int32 VertexIndex = 0 ; VertexIndex < BakedTile->PositionList.Num ( ) ; ++VertexIndex )
+					{
+						VertexIDList [ VertexIndex ] = GetWeldVertexID ( ( BakedTile->PositionList [ VertexIndex ] * LODStep ) + MarchingMeshLocation );
+					}
+
+					// Border normal need the weld vertex, so it is resolve on first use by a triangle
+					for ( int32 NormalIndex = 0 ; NormalIndex < BakedTile->NormalList.Num ( ) ; ++NormalIndex )
+					{
+						NormalIDList [ NormalIndex ] = BakedTile->BorderNormalList [ NormalIndex ] ? INDEX_NONE : NormalOverlay->AppendElement ( BakedTile->NormalList [ NormalIndex ] );
+					}
+
+					for ( int32 UVIndex = 0 ; UVIndex < BakedTile->UVList.Num ( ) && BoxUVProjector == nullptr ; ++UVIndex )
+					{
+						UVIDList [ UVIndex ] = UVOverlay->AppendElement ( BakedTile->UVList [ UVIndex ] );
+					}
+
+					for ( int32 TriangleIndex = 0 ; TriangleIndex < BakedTile->TriangleList.Num ( ) ; ++TriangleIndex )
+					{
+						const FIntVector3& Triangle = BakedTile->TriangleList [ TriangleIndex ];
+
+						const int32 TriangleID = AppendWeldTriangle ( FIntVector3 ( VertexIDList [ Triangle.X ] , VertexIDList [ Triangle.Y ] , VertexIDList [ Triangle.Z ] ) , BakedTile->GroupIDList [ TriangleIndex ] );
+
+						if ( TriangleID < 0 )
+						{
+							continue;
+						}
+
+						if ( const FIntVector3& TriangleNormal = BakedTile->TriangleNormalList [ TriangleIndex ] ; TriangleNormal.X != INDEX_NONE )
+						{
+							for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+							{
+								if ( NormalIDList [ TriangleNormal [ Corner ] ] == INDEX_NONE )
+								{
+									NormalIDList [ TriangleNormal [ Corner ] ] = GetNormalElementID ( MeshData->GetTriangle ( TriangleID ) [ Corner ] , BakedTile->NormalList [ TriangleNormal [ Corner ] ] , true );
+								}
+							}
+
+							NormalOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( NormalIDList [ TriangleNormal.X ] , NormalIDList [ TriangleNormal.Y ] , NormalIDList [ TriangleNormal.Z ] ) );
+						}
+
+						if ( BoxUVProjector != nullptr )
+						{
+							SetBoxUVTriangle ( TriangleID );
+						}
+						else if ( const FIntVector3& TriangleUV = BakedTile->TriangleUVList [ TriangleIndex ] ; TriangleUV.X != INDEX_NONE )
+						{
+							UVOverlay->SetTriangle ( TriangleID , UE::Geometry::FIndex3i ( UVIDList [ TriangleUV.X ] , UVIDList [ TriangleUV.Y ] , UVIDList [ TriangleUV.Z ] ) );
+						}
 
-					if ( AppendMesh == nullptr )
+						MaterialAttribute->SetValue ( TriangleID , BakedTile->MaterialIDList [ TriangleIndex ] + MaterialOffset );
+					}
+				}
+
+				for ( const auto& BorderNormal : BorderNormalMap )
+				{
+					for ( const LPPMarchingStreamMesher::FBorderNormalElement& Element : BorderNormal.Value )
 					{
-						UE_LOG ( LogTemp , Error , TEXT ( "Marching Data : Mesh Invalid %i" ) , MeshMappingData.MeshID );
-
-						continue;
+						NormalOverlay->SetElement ( Element.ElementID , Element.NormalSum.GetSafeNormal ( UE_SMALL_NUMBER , Element.Normal ) );
 					}
-
-					const FTransform AppendTransform (
-					                                  MeshMappingData.GetRotation ( ) ,
-					                                  MarchingMeshLocation ,
-					                                  FVector ( 1.0f )
-					                                 );
-
-					UE::Geometry::FTransformSRT3d    XForm ( AppendTransform );
-					UE::Geometry::FMeshIndexMappings TmpMappings;
-					Editor.AppendMesh ( AppendMesh , TmpMappings ,
-					                    [&XForm] ( const int32 VID , const FVector3d& Position ) { return XForm.TransformPosition ( Position ); } ,
-					                    [&XForm] ( const int32 NID , const FVector3d& Normal ) { return XForm.TransformNormal ( Normal ); } ,
-					                    XForm.GetDeterminant ( ) < 0 );
 				}
 			}
 
+			// Coarse side carry the skirt, LOD 0 chunk stay untouch
+			if ( PassData.LODIndex > 0 && PassData.bGenerateLODSkirt )
 			{
-				UE::Geometry::FMergeCoincidentMeshEdges Welder ( MeshData );
-				Welder.MergeVertexTolerance = PassData.EdgeMergeDistance;
-				Welder.OnlyUniquePairs      = false;
-				Welder.Apply ( );
-			}
+				const float SkirtDepth = MeshCellSize.GetMin ( );
 
-			{
-				const FVector EdgeDirectionList [ 6 ] =
+				if ( ThreadData->StreamData.IsEmpty ( ) == false )
 				{
-					FVector ( 1 , 0 , 0 ) ,
-					FVector ( 0 , 1 , 0 ) ,
-					FVector ( 0 , 0 , 1 ) ,
-					FVector ( -1 , 0 , 0 ) ,
-					FVector ( 0 , -1 , 0 ) ,
-					FVector ( 0 , 0 , -1 )
-				};
-
-				for ( const FVector& EdgeDirection : EdgeDirectionList )
+					LPPMarchingStreamMesher::AddStreamSkirt ( ThreadData->StreamData , FVector3f ( MeshBoundHalfSize ) , SkirtDepth , PassData.EdgeMergeDistance );
+				}
+				else
 				{
-					UE::Geometry::FMeshPlaneCut Cut ( MeshData , EdgeDirection * MeshBoundHalfSize , EdgeDirection );
-					Cut.Cut ( );
+					LPPMarchingStreamMesher::AddMeshSkirt ( *MeshData , FVector3f ( MeshBoundHalfSize ) , SkirtDepth , PassData.EdgeMergeDistance );
 				}
 			}
 
-			if ( PassData.bRecomputeBoxUV )
+			if ( PassData.bSimplifyRenderData && PassData.SimplifyMethod == ELPPMarchingSimplifyMethod::PlanarMerge )
 			{
-				FDynamicMeshUVOverlay*             UVOverlay = MeshData->Attributes ( )->PrimaryUV ( );
-				UE::Geometry::FDynamicMeshUVEditor UVEditor ( MeshData , UVOverlay );
-
-				TArray < int32 > TriangleROI;
-				for ( const int32 TriangleID : MeshData->TriangleIndicesItr ( ) )
-				{
-					TriangleROI.Add ( TriangleID );
-				}
-
-				constexpr int32 MinIslandTriCount = 2;
-
-				MeshAdapterTransforms::FFrame3d ProjectionFrame ( PassData.UVBoxTransform );
-				UVEditor.SetTriangleUVsFromBoxProjection ( TriangleROI , [&] ( const FVector3d& Pos ) { return Pos; } ,
-				                                           ProjectionFrame , PassData.UVBoxTransform.GetScale3D ( ) , MinIslandTriCount );
+				LPPMarchingStreamMesher::MergePlanarRegion ( *MeshData , PassData.SimplifyAngle , PassData.EdgeMergeDistance );
 			}
-
-			if ( PassData.bSimplifyRenderData )
+			else if ( PassData.bSimplifyRenderData )
 			{
 				UE::Geometry::FQEMSimplification Simplifier ( MeshData );
 
 				Simplifier.bAllowSeamCollapse = true;
 				//Simplifier.bPreserveBoundaryShape = true;
-				Simplifier.SimplifyToMinimalPlanar ( PassData.SimplifyAngle );
 
-				UE::Geometry::FMeshNormals MeshNormals ( MeshData );
-				MeshNormals.RecomputeOverlayNormals ( MeshData->Attributes ( )->PrimaryNormals ( ) , true , true );
-				MeshNormals.CopyToOverlay ( MeshData->Attributes ( )->PrimaryNormals ( ) , false );
+				// Only planar region collapse and overlay element follow the collapse, baked normal stay valid
+				Simplifier.SimplifyToMinimalPlanar ( PassData.SimplifyAngle );
 			}
 
 			MeshData->RemoveUnusedVertices ( );
@@ -745,85 +2856,63 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction ( TUniquePtr
 	}
 
 	// Lumen Card
-	if ( PassData.bRenderData )
+	if ( PassData.bRenderData && ThreadData->bIsSolidUnchanged == false )
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE ( MarchingMesh_GeneratingLumen );
 
-		auto SetCoverIndex = [&] ( FIntPoint& CoverIndex , const int32 Index )
+		FLPPMarchingStageTiming::FScope StageTimer ( ThreadData->StageTiming.Lumen );
+
+		/* Depth range of one card and the plane cell it cover, plane axis follow FaceLoopDirectionList */
+		struct FLFPLumenSweepCard
 		{
-			if ( Index <= -1 )
-			{
-				CoverIndex = FIntPoint ( INDEX_NONE );
-			}
-			else if ( CoverIndex.GetMin ( ) == INDEX_NONE )
-			{
-				CoverIndex = FIntPoint ( Index );
-			}
-			else if ( CoverIndex.X > Index )
+			FIntPoint CoverIndex   = FIntPoint ( INDEX_NONE );
+			FIntPoint FootprintMin = FIntPoint ( MAX_int32 );
+			FIntPoint FootprintMax = FIntPoint ( MIN_int32 );
+
+			FORCEINLINE bool IsValid ( ) const { return CoverIndex.X != INDEX_NONE; }
+
+			void AddDepth ( const int32 DepthIndex , const FIntPoint& PlaneMin , const FIntPoint& PlaneMax )
 			{
-				CoverIndex.X = Index;
+				CoverIndex   = IsValid ( ) ? FIntPoint ( FMath::Min ( CoverIndex.X , DepthIndex ) , FMath::Max ( CoverIndex.Y , DepthIndex ) ) : FIntPoint ( DepthIndex );
+				FootprintMin = FootprintMin.ComponentMin ( PlaneMin );
+				FootprintMax = FootprintMax.ComponentMax ( PlaneMax );
 			}
-			else if ( CoverIndex.Y < Index )
+
+			void Merge ( const FLFPLumenSweepCard& Other )
 			{
-				CoverIndex.Y = Index;
+				CoverIndex   = FIntPoint ( FMath::Min ( CoverIndex.X , Other.CoverIndex.X ) , FMath::Max ( CoverIndex.Y , Other.CoverIndex.Y ) );
+				FootprintMin = FootprintMin.ComponentMin ( Other.FootprintMin );
+				FootprintMax = FootprintMax.ComponentMax ( Other.FootprintMax );
 			}
 		};
 
-		auto CheckFaceVisible = [&] ( const FIntVector& CurrentPos , const FIntVector& FromDirection )
+		auto AddCardBuild = [&] ( TArray < FLumenCardBuildData >& CardBuildList , const FLFPLumenSweepCard& SweepCard , const int32 DirectionIndex )
 		{
-			const FIntVector TargetCheckPos  = CurrentPos + FIntVector ( 1 );
-			const FIntVector CurrentCheckPos = TargetCheckPos + FromDirection;
-
-			const int32 TargetIndex  = ULFPGridLibrary::ToGridIndex ( TargetCheckPos , CacheDataSize );
-			const int32 CurrentIndex = ULFPGridLibrary::ToGridIndex ( CurrentCheckPos , CacheDataSize );
-
-			return SolidList [ CurrentIndex ] == false && SolidList [ TargetIndex ];
-		};
+			const FIntVector& LoopAxis = LFPMarchingRenderConstantData::FaceLoopDirectionList [ DirectionIndex ];
 
-		auto AddCardBuild = [&] ( TArray < FLumenCardBuildData >& CardBuildList , const FIntPoint& CoverIndex , const int32 DirectionIndex )
-		{
-			FBox3f LumenBox;
+			FVector BoxMin;
+			FVector BoxMax;
 
-			switch ( DirectionIndex )
+			// Card facing positive sit on the far side of its cell
 			{
-				case 0 :
-				case 3 : LumenBox = FBox3f (
-				                            FVector3f ( CurrentLocalBounds.Min.X , CurrentLocalBounds.Min.Y , ( CoverIndex.X * MeshFullSize.Z ) - MeshBoundHalfSize.Z - BoundExpand ) ,
-				                            FVector3f ( CurrentLocalBounds.Max.X , CurrentLocalBounds.Max.Y , ( CoverIndex.Y * MeshFullSize.Z ) - MeshBoundHalfSize.Z + BoundExpand )
-				                           );
-
-					if ( DirectionIndex == 0 )
-					{
-						LumenBox = LumenBox.ShiftBy ( FVector3f ( 0.0f , 0.0f , MeshFullSize.Z ) );
-					}
-					break;
-
-				case 1 :
-				case 4 : LumenBox = FBox3f (
-				                            FVector3f ( ( CoverIndex.X * MeshFullSize.X ) - MeshBoundHalfSize.X - BoundExpand , CurrentLocalBounds.Min.Y , CurrentLocalBounds.Min.Z ) ,
-				                            FVector3f ( ( CoverIndex.Y * MeshFullSize.X ) - MeshBoundHalfSize.X + BoundExpand , CurrentLocalBounds.Max.Y , CurrentLocalBounds.Max.Z )
-				                           );
+				const int32  DepthAxis  = LoopAxis.Z;
+				const double DepthShift = LFPMarchingRenderConstantData::FaceDirection [ DirectionIndex ].Up [ DepthAxis ] > 0 ? MeshFullSize [ DepthAxis ] : 0.0;
 
-					if ( DirectionIndex == 4 )
-					{
-						LumenBox = LumenBox.ShiftBy ( FVector3f ( MeshFullSize.X , 0.0f , 0.0f ) );
-					}
-					break;
+				BoxMin [ DepthAxis ] = ( SweepCard.CoverIndex.X * MeshFullSize [ DepthAxis ] ) - MeshBoundHalfSize [ DepthAxis ] - BoundExpand + DepthShift;
+				BoxMax [ DepthAxis ] = ( SweepCard.CoverIndex.Y * MeshFullSize [ DepthAxis ] ) - MeshBoundHalfSize [ DepthAxis ] + BoundExpand + DepthShift;
+			}
 
-				case 2 :
-				case 5 : LumenBox = FBox3f (
-				                            FVector3f ( CurrentLocalBounds.Min.X , ( CoverIndex.X * MeshFullSize.Y ) - MeshBoundHalfSize.Y - BoundExpand , CurrentLocalBounds.Min.Z ) ,
-				                            FVector3f ( CurrentLocalBounds.Max.X , ( CoverIndex.Y * MeshFullSize.Y ) - MeshBoundHalfSize.Y + BoundExpand , CurrentLocalBounds.Max.Z )
-				                           );
+			// Tile surface can reach half a cell past the voxel face, so keep one cell margin around the footprint
+			for ( int32 PlaneAxis = 0 ; PlaneAxis < 2 ; ++PlaneAxis )
+			{
+				const int32 Axis = LoopAxis [ PlaneAxis ];
 
-					if ( DirectionIndex == 2 )
-					{
-						LumenBox = LumenBox.ShiftBy ( FVector3f ( 0.0f , MeshFullSize.Y , 0.0f ) );
-					}
-					break;
-				default : break;
+				BoxMin [ Axis ] = FMath::Max ( ( ( SweepCard.FootprintMin [ PlaneAxis ] - 1 ) * MeshFullSize [ Axis ] ) - MeshBoundHalfSize [ Axis ] - BoundExpand , CurrentLocalBounds.Min [ Axis ] );
+				BoxMax [ Axis ] = FMath::Min ( ( ( SweepCard.FootprintMax [ PlaneAxis ] + 2 ) * MeshFullSize [ Axis ] ) - MeshBoundHalfSize [ Axis ] + BoundExpand , CurrentLocalBounds.Max [ Axis ] );
 			}
 
+			const FBox3f LumenBox = FBox3f ( FVector3f ( BoxMin ) , FVector3f ( BoxMax ) );
+
 			FLumenCardBuildData BuildData;
 
 			BuildData.AxisAlignedDirectionIndex = LFPMarchingRenderConstantData::SurfaceDirectionID [ DirectionIndex ];
@@ -846,24 +2935,21 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction ( TUniquePtr
 
 		TArray < FLumenCardBuildData >& CardBuildList = ThreadData->LumenCardData.CardBuildData;
 
-		CardBuildList.Empty ( );
-
-		struct FLFPFaceListData
-		{
-			FLFPFaceListData ( const FIntVector InID , const int32 InFaceID , const bool InbIsReverse ) : ID ( InID ), FaceID ( InFaceID ), bIsReverse ( InbIsReverse )
-			{
-			}
-
-			const FIntVector ID         = FIntVector ( 0 , 1 , 2 );
-			const int32      FaceID     = 0;
-			const bool       bIsReverse = false;
-		};
+		CardBuildList.Reset ( );
 
 		constexpr bool FaceReverseList [ ] =
 		{
 			true , false , true , false , true , false
 		};
 
+		TArray < FLFPLumenSweepCard > SweepCardList [ 6 ];
+
+		int32 SweepCardCount = 0;
+
+		// One bit per plane cell, BlockMask is every face already on the open card
+		TArray < uint64 > PlaneMask;
+		TArray < uint64 > BlockMask;
+
 		for ( int32 Direction = 0 ; Direction < 6 ; ++Direction )
 		{
 			if ( Progress.Cancelled ( ) )
@@ -871,70 +2957,142 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction ( TUniquePtr
 				return;
 			}
 
-			const FIntVector MarchingDimension = FIntVector (
-			                                                 DataSize [ LFPMarchingRenderConstantData::FaceLoopDirectionList [ Direction ].X ] ,
-			                                                 DataSize [ LFPMarchingRenderConstantData::FaceLoopDirectionList [ Direction ].Y ] ,
-			                                                 DataSize [ LFPMarchingRenderConstantData::FaceLoopDirectionList [ Direction ].Z ]
-			                                                );
+			const FIntVector& LoopAxis = LFPMarchingRenderConstantData::FaceLoopDirectionList [ Direction ];
 
-			const int32 MarchingPlaneLength = MarchingDimension.X * MarchingDimension.Y;
+			const FIntVector MarchingDimension = FIntVector ( DataSize [ LoopAxis.X ] , DataSize [ LoopAxis.Y ] , DataSize [ LoopAxis.Z ] );
 
-			FIntPoint CoverIndex = FIntPoint ( INDEX_NONE );
+			const int32 MaskWordNum = FMath::DivideAndRoundUp ( MarchingDimension.X * MarchingDimension.Y , 64 );
 
-			TBitArray < > BlockMap = TBitArray ( false , MarchingPlaneLength );
+			PlaneMask.SetNumUninitialized ( MaskWordNum , EAllowShrinking::No );
+			BlockMask.Init ( 0 , MaskWordNum );
 
 			const bool& bIsReverse = FaceReverseList [ Direction ];
 
-			for ( int32 DepthIndex = bIsReverse
-			                         ? MarchingDimension.Z - 1
-			                         : 0 ; bIsReverse
-			                               ? DepthIndex > -1
-			                               : DepthIndex < MarchingDimension.Z ; bIsReverse
-			                                                                    ? DepthIndex--
-			                                                                    : DepthIndex++ )
+			FLFPLumenSweepCard SweepCard;
+
+			// Every plane is scan once, sweep start from the side the face is looking at
+			for ( int32 DepthStep = 0 ; DepthStep < MarchingDimension.Z ; ++DepthStep )
 			{
-			StartCheck:
+				const int32 DepthIndex = bIsReverse ? MarchingDimension.Z - 1 - DepthStep : DepthStep;
+
+				FMemory::Memzero ( PlaneMask.GetData ( ) , MaskWordNum * sizeof ( uint64 ) );
 
-				for ( int32 X = 0 ; X < MarchingDimension.X ; X++ )
+				FIntPoint PlaneMin = FIntPoint ( MAX_int32 );
+				FIntPoint PlaneMax = FIntPoint ( MIN_int32 );
+
+				for ( int32 Y = 0 ; Y < MarchingDimension.Y ; ++Y )
 				{
-					for ( int32 Y = 0 ; Y < MarchingDimension.Y ; Y++ )
+					int32 RowStart = INDEX_NONE;
+					int32 RowEnd   = INDEX_NONE;
+
+					for ( int32 X = 0 ; X < MarchingDimension.X ; ++X )
 					{
 						FIntVector MarchingGridLocation;
-						MarchingGridLocation [ LFPMarchingRenderConstantData::FaceLoopDirectionList [ Direction ].X ] = X;
-						MarchingGridLocation [ LFPMarchingRenderConstantData::FaceLoopDirectionList [ Direction ].Y ] = Y;
-						MarchingGridLocation [ LFPMarchingRenderConstantData::FaceLoopDirectionList [ Direction ].Z ] = DepthIndex;
+						MarchingGridLocation [ LoopAxis.X ] = X;
+						MarchingGridLocation [ LoopAxis.Y ] = Y;
+						MarchingGridLocation [ LoopAxis.Z ] = DepthIndex;
+
+						if ( SolidList.IsFaceVisible ( MarchingGridLocation , LFPMarchingRenderConstantData::FaceDirection [ Direction ].Up ) == false )
+						{
+							continue;
+						}
 
 						const int32 MarchingPlaneIndex = X + ( Y * MarchingDimension.X );
 
-						const bool bIsFaceVisible = CheckFaceVisible ( MarchingGridLocation , LFPMarchingRenderConstantData::FaceDirection [ Direction ].Up );
+						PlaneMask [ MarchingPlaneIndex >> 6 ] |= uint64 ( 1 ) << ( MarchingPlaneIndex & 63 );
 
-						if ( BlockMap [ MarchingPlaneIndex ] )
-						{
-							if ( bIsFaceVisible )
-							{
-								AddCardBuild ( CardBuildList , CoverIndex , Direction );
+						RowStart = RowStart == INDEX_NONE ? X : RowStart;
+						RowEnd   = X;
+					}
+
+					if ( RowStart != INDEX_NONE )
+					{
+						PlaneMin = PlaneMin.ComponentMin ( FIntPoint ( RowStart , Y ) );
+						PlaneMax = PlaneMax.ComponentMax ( FIntPoint ( RowEnd , Y ) );
+					}
+				}
 
-								/* Reset */
-								BlockMap = TBitArray ( false , MarchingPlaneLength );
+				if ( PlaneMin.X == MAX_int32 )
+				{
+					continue;
+				}
 
-								SetCoverIndex ( CoverIndex , INDEX_NONE );
+				// Face behind a face already on the card would be hidden by it, so the card end before this plane
+				bool bIsOverlap = false;
 
-								goto StartCheck;
-							}
-						}
-						else if ( bIsFaceVisible )
-						{
-							BlockMap [ MarchingPlaneIndex ] = bIsFaceVisible;
+				for ( int32 WordIndex = 0 ; WordIndex < MaskWordNum && bIsOverlap == false ; ++WordIndex )
+				{
+					bIsOverlap = ( PlaneMask [ WordIndex ] & BlockMask [ WordIndex ] ) != 0;
+				}
 
-							SetCoverIndex ( CoverIndex , DepthIndex );
-						}
+				if ( bIsOverlap )
+				{
+					SweepCardList [ Direction ].Add ( SweepCard );
+
+					SweepCard = FLFPLumenSweepCard ( );
+
+					FMemory::Memzero ( BlockMask.GetData ( ) , MaskWordNum * sizeof ( uint64 ) );
+				}
+
+				for ( int32 WordIndex = 0 ; WordIndex < MaskWordNum ; ++WordIndex )
+				{
+					BlockMask [ WordIndex ] |= PlaneMask [ WordIndex ];
+				}
+
+				SweepCard.AddDepth ( DepthIndex , PlaneMin , PlaneMax );
+			}
+
+			if ( SweepCard.IsValid ( ) )
+			{
+				SweepCardList [ Direction ].Add ( SweepCard );
+			}
+
+			SweepCardCount += SweepCardList [ Direction ].Num ( );
+		}
+
+		// Over the limit , merge the neighbour card pair on the same direction with the smallest combine depth
+		while ( PassData.MaxLumenCardCount > 0 && SweepCardCount > PassData.MaxLumenCardCount )
+		{
+			int32 BestDirection = INDEX_NONE;
+			int32 BestIndex     = INDEX_NONE;
+			int32 BestSpan      = MAX_int32;
+
+			for ( int32 Direction = 0 ; Direction < 6 ; ++Direction )
+			{
+				const TArray < FLFPLumenSweepCard >& DirectionCardList = SweepCardList [ Direction ];
+
+				for ( int32 CardIndex = 0 ; CardIndex < DirectionCardList.Num ( ) - 1 ; ++CardIndex )
+				{
+					const int32 MergeSpan = FMath::Max ( DirectionCardList [ CardIndex ].CoverIndex.Y , DirectionCardList [ CardIndex + 1 ].CoverIndex.Y ) - FMath::Min ( DirectionCardList [ CardIndex ].CoverIndex.X , DirectionCardList [ CardIndex + 1 ].CoverIndex.X );
+
+					if ( MergeSpan < BestSpan )
+					{
+						BestDirection = Direction;
+						BestIndex     = CardIndex;
+						BestSpan      = MergeSpan;
 					}
 				}
 			}
 
-			if ( CoverIndex.GetMin ( ) != INDEX_NONE )
+			// One card per direction left, can't go lower
+			if ( BestDirection == INDEX_NONE )
+			{
+				break;
+			}
+
+			SweepCardList [ BestDirection ] [ BestIndex ].Merge ( SweepCardList [ BestDirection ] [ BestIndex + 1 ] );
+			SweepCardList [ BestDirection ].RemoveAt ( BestIndex + 1 );
+
+			SweepCardCount -= 1;
+		}
+
+		CardBuildList.Reserve ( SweepCardCount );
+
+		for ( int32 Direction = 0 ; Direction < 6 ; ++Direction )
+		{
+			for ( const FLFPLumenSweepCard& SweepCard : SweepCardList [ Direction ] )
 			{
-				AddCardBuild ( CardBuildList , CoverIndex , Direction );
+				AddCardBuild ( CardBuildList , SweepCard , Direction );
 			}
 		}
 	}
@@ -945,106 +3103,289 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction ( TUniquePtr
 	}
 
 	// Collision Box
-	if ( PassData.bSimpleBoxCollisionData )
+	if ( PassData.bSimpleBoxCollisionData && ThreadData->bIsSolidUnchanged == false )
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE ( MarchingMesh_GeneratingBoxCollision );
 
-		TMap < FIntVector , FIntVector > BatchDataMap;
+		FLPPMarchingStageTiming::FScope StageTimer ( ThreadData->StageTiming.Collision );
+
+		// Claimed cell is clear from this copy, apron cell is never read
+		FLPPMarchingSolidCache& ClaimList = ThreadData->CollisionClaimCache;
 
-		TPair < FIntVector , FIntVector > CurrentBatchData ( INDEX_NONE , INDEX_NONE );
+		ClaimList = SolidList;
 
-		bool IsBatchValid = false;
+		/* Cell range [ Min , Max ) in apron space */
+		TArray < TPair < FIntVector , FIntVector > > BoxList;
 
-		const auto& PushData = [&] ( )
+		/** Greedy Box, max X run then max Y then max Z */
+		for ( int32 Z = 1 ; Z <= DataSize.Z ; Z++ )
 		{
+			if ( Progress.Cancelled ( ) )
 			{
-				const FIntVector  TargetMax    = CurrentBatchData.Key - FIntVector ( 0 , 1 , 0 );
-				const FIntVector* TargetMinPtr = BatchDataMap.Find ( TargetMax );
-
-				if ( TargetMinPtr != nullptr && TargetMinPtr->X == CurrentBatchData.Value.X && TargetMinPtr->Z == CurrentBatchData.Value.Z )
-				{
-					const FIntVector TargetMin = BatchDataMap.FindAndRemoveChecked ( TargetMax );
-
-					CurrentBatchData.Value.Y = TargetMin.Y;
-				}
+				return;
 			}
 
+			for ( int32 Y = 1 ; Y <= DataSize.Y ; Y++ )
 			{
-				const FIntVector  TargetMax    = CurrentBatchData.Key - FIntVector ( 0 , 0 , 1 );
-				const FIntVector* TargetMinPtr = BatchDataMap.Find ( TargetMax );
+				uint64* ClaimRow = ClaimList.GetRow ( Y , Z );
 
-				if ( TargetMinPtr != nullptr && TargetMinPtr->X == CurrentBatchData.Value.X && TargetMinPtr->Y == CurrentBatchData.Value.Y )
+				int32 RunStart = ClaimList.FindNext ( ClaimRow , 1 , true );
+
+				while ( RunStart <= DataSize.X )
 				{
-					const FIntVector TargetMin = BatchDataMap.FindAndRemoveChecked ( TargetMax );
+					const int32 RunEnd = FMath::Min ( ClaimList.FindNext ( ClaimRow , RunStart , false ) , DataSize.X + 1 );
+
+					int32 BoxEndY = Y + 1;
+
+					while ( BoxEndY <= DataSize.Y && ClaimList.IsRangeSet ( ClaimList.GetRow ( BoxEndY , Z ) , RunStart , RunEnd ) )
+					{
+						++BoxEndY;
+					}
+
+					int32 BoxEndZ = Z + 1;
+
+					for ( ; BoxEndZ <= DataSize.Z ; ++BoxEndZ )
+					{
+						bool bIsSliceSet = true;
+
+						for ( int32 SliceY = Y ; SliceY < BoxEndY && bIsSliceSet ; ++SliceY )
+						{
+							bIsSliceSet = ClaimList.IsRangeSet ( ClaimList.GetRow ( SliceY , BoxEndZ ) , RunStart , RunEnd );
+						}
+
+						if ( bIsSliceSet == false )
+						{
+							break;
+						}
+					}
+
+					for ( int32 ClaimZ = Z ; ClaimZ < BoxEndZ ; ++ClaimZ )
+					{
+						for ( int32 ClaimY = Y ; ClaimY < BoxEndY ; ++ClaimY )
+						{
+							ClaimList.ClearRange ( ClaimList.GetRow ( ClaimY , ClaimZ ) , RunStart , RunEnd );
+						}
+					}
 
-					CurrentBatchData.Value.Z = TargetMin.Z;
+					BoxList.Add ( TPair < FIntVector , FIntVector > ( FIntVector ( RunStart , Y , Z ) , FIntVector ( RunEnd , BoxEndY , BoxEndZ ) ) );
+
+					RunStart = ClaimList.FindNext ( ClaimRow , RunEnd , true );
 				}
 			}
+		}
 
-			BatchDataMap.Add ( CurrentBatchData.Key , CurrentBatchData.Value );
-			IsBatchValid = false;
-		};
+		if ( Progress.Cancelled ( ) )
+		{
+			return;
+		}
 
-		/** Generate Batch Data Map */
-		for ( int32 Z = 0 ; Z < DataSize.Z ; Z++ )
+		/** Box Budget, touching pair that add the least empty volume is merge first, pair sharing a matching face add none */
+		if ( PassData.MaxCollisionBoxCount > 0 && BoxList.Num ( ) > PassData.MaxCollisionBoxCount )
 		{
-			if ( Progress.Cancelled ( ) )
+			/* Merge candidate, version is bump when a box grow so stale pair is skip on pop */
+			struct FLFPBoxMergePair
 			{
-				return;
-			}
+				int64 Cost     = 0;
+				int32 IndexA   = INDEX_NONE;
+				int32 IndexB   = INDEX_NONE;
+				int32 VersionA = 0;
+				int32 VersionB = 0;
+			};
 
-			for ( int32 Y = 0 ; Y < DataSize.Y ; Y++ )
+			const auto GetVolume = [] ( const FIntVector& Min , const FIntVector& Max ) -> int64
 			{
-				for ( int32 X = 0 ; X < DataSize.X ; X++ )
-				{
-					/***************** Identify Data *****************/
-					const FIntVector CurrentPos ( X , Y , Z );
+				const FIntVector Extent = Max - Min;
+
+				return static_cast < int64 > ( Extent.X ) * Extent.Y * Extent.Z;
+			};
+
+			const auto GetUnion = [] ( const TPair < FIntVector , FIntVector >& BoxA , const TPair < FIntVector , FIntVector >& BoxB )
+			{
+				return TPair < FIntVector , FIntVector > (
+				                                           FIntVector ( FMath::Min ( BoxA.Key.X , BoxB.Key.X ) , FMath::Min ( BoxA.Key.Y , BoxB.Key.Y ) , FMath::Min ( BoxA.Key.Z , BoxB.Key.Z ) ) ,
+				                                           FIntVector ( FMath::Max ( BoxA.Value.X , BoxB.Value.X ) , FMath::Max ( BoxA.Value.Y , BoxB.Value.Y ) , FMath::Max ( BoxA.Value.Z , BoxB.Value.Z ) )
+				                                          );
+			};
+
+			const auto MergePredicate = [] ( const FLFPBoxMergePair& A , const FLFPBoxMergePair& B )
+			{
+				return A.Cost < B.Cost;
+			};
+
+			TArray < int32 >            BoxVersionList;
+			TArray < bool >             BoxAliveList;
+			TArray < TArray < int32 > > BoxNeighbourList;
+			TArray < FLFPBoxMergePair > MergeHeap;
+
+			BoxVersionList.SetNumZeroed ( BoxList.Num ( ) );
+			BoxAliveList.Init ( true , BoxList.Num ( ) );
+			BoxNeighbourList.SetNum ( BoxList.Num ( ) );
+
+			const auto PushPair = [&] ( const int32 IndexA , const int32 IndexB )
+			{
+				const TPair < FIntVector , FIntVector >& BoxA     = BoxList [ IndexA ];
+				const TPair < FIntVector , FIntVector >& BoxB     = BoxList [ IndexB ];
+				const TPair < FIntVector , FIntVector >  MergeBox = GetUnion ( BoxA , BoxB );
+
+				FLFPBoxMergePair MergePair;
+
+				MergePair.Cost     = GetVolume ( MergeBox.Key , MergeBox.Value ) - GetVolume ( BoxA.Key , BoxA.Value ) - GetVolume ( BoxB.Key , BoxB.Value );
+				MergePair.IndexA   = IndexA;
+				MergePair.IndexB   = IndexB;
+				MergePair.VersionA = BoxVersionList [ IndexA ];
+				MergePair.VersionB = BoxVersionList [ IndexB ];
+
+				MergeHeap.HeapPush ( MergePair , MergePredicate );
+			};
+
+			// Owner box of every solid cell, neighbour is find by stepping one cell past each max face
+			{
+				TArray < int32 > CellOwnerList;
 
-					const int32 CurrentIndex = ULFPGridLibrary::ToGridIndex ( CurrentPos + FIntVector ( 1 ) , CacheDataSize );
+				CellOwnerList.Init ( INDEX_NONE , DataSize.X * DataSize.Y * DataSize.Z );
 
-					/*************************************************/
+				for ( int32 BoxIndex = 0 ; BoxIndex < BoxList.Num ( ) ; ++BoxIndex )
+				{
+					const TPair < FIntVector , FIntVector >& Box = BoxList [ BoxIndex ];
 
-					if ( SolidList [ CurrentIndex ] )
+					for ( int32 Z = Box.Key.Z ; Z < Box.Value.Z ; ++Z )
 					{
-						if ( ( CurrentBatchData.Key.Y != Y || CurrentBatchData.Key.Z != Z ) && IsBatchValid )
+						for ( int32 Y = Box.Key.Y ; Y < Box.Value.Y ; ++Y )
 						{
-							PushData ( );
+							for ( int32 X = Box.Key.X ; X < Box.Value.X ; ++X )
+							{
+								CellOwnerList [ ULFPGridLibrary::ToGridIndex ( FIntVector ( X - 1 , Y - 1 , Z - 1 ) , DataSize ) ] = BoxIndex;
+							}
 						}
+					}
+				}
+
+				for ( int32 BoxIndex = 0 ; BoxIndex < BoxList.Num ( ) ; ++BoxIndex )
+				{
+					for ( int32 Axis = 0 ; Axis < 3 ; ++Axis )
+					{
+						const TPair < FIntVector , FIntVector >& Box = BoxList [ BoxIndex ];
 
-						if ( IsBatchValid )
+						if ( Box.Value [ Axis ] > DataSize [ Axis ] )
 						{
-							CurrentBatchData.Key.X += 1;
+							continue;
 						}
-						else
+
+						FIntVector FaceMin = Box.Key;
+						FIntVector FaceMax = Box.Value;
+
+						FaceMin [ Axis ] = Box.Value [ Axis ];
+						FaceMax [ Axis ] = Box.Value [ Axis ] + 1;
+
+						for ( int32 Z = FaceMin.Z ; Z < FaceMax.Z ; ++Z )
+						{
+							for ( int32 Y = FaceMin.Y ; Y < FaceMax.Y ; ++Y )
+							{
+								for ( int32 X = FaceMin.X ; X < FaceMax.X ; ++X )
+								{
+									const int32 OwnerIndex = CellOwnerList [ ULFPGridLibrary::ToGridIndex ( FIntVector ( X - 1 , Y - 1 , Z - 1 ) , DataSize ) ];
+
+									if ( OwnerIndex == INDEX_NONE || BoxNeighbourList [ BoxIndex ].Contains ( OwnerIndex ) )
+									{
+										continue;
+									}
+
+									BoxNeighbourList [ BoxIndex ].Add ( OwnerIndex );
+									BoxNeighbourList [ OwnerIndex ].Add ( BoxIndex );
+
+									PushPair ( BoxIndex , OwnerIndex );
+								}
+							}
+						}
+					}
+				}
+			}
+
+			int32 AliveCount = BoxList.Num ( );
+
+			while ( AliveCount > PassData.MaxCollisionBoxCount )
+			{
+				// Only disconnected island is left, chain them in build order so nearby island join first
+				if ( MergeHeap.IsEmpty ( ) )
+				{
+					int32 LastIndex = INDEX_NONE;
+
+					for ( int32 BoxIndex = 0 ; BoxIndex < BoxList.Num ( ) ; ++BoxIndex )
+					{
+						if ( BoxAliveList [ BoxIndex ] == false )
 						{
-							CurrentBatchData.Key   = CurrentPos;
-							CurrentBatchData.Value = CurrentPos;
-							IsBatchValid           = true;
+							continue;
 						}
+
+						if ( LastIndex != INDEX_NONE )
+						{
+							PushPair ( LastIndex , BoxIndex );
+						}
+
+						LastIndex = BoxIndex;
 					}
-					else if ( IsBatchValid )
+				}
+
+				FLFPBoxMergePair MergePair;
+
+				MergeHeap.HeapPop ( MergePair , MergePredicate , EAllowShrinking::No );
+
+				const int32 IndexA = MergePair.IndexA;
+				const int32 IndexB = MergePair.IndexB;
+
+				if ( BoxAliveList [ IndexA ] == false || BoxAliveList [ IndexB ] == false || BoxVersionList [ IndexA ] != MergePair.VersionA || BoxVersionList [ IndexB ] != MergePair.VersionB )
+				{
+					continue;
+				}
+
+				BoxList [ IndexA ] = GetUnion ( BoxList [ IndexA ] , BoxList [ IndexB ] );
+
+				BoxVersionList [ IndexA ] += 1;
+				BoxAliveList [ IndexB ]    = false;
+				AliveCount                -= 1;
+
+				// A take over every neighbour of B
+				for ( const int32 NeighbourIndex : BoxNeighbourList [ IndexB ] )
+				{
+					BoxNeighbourList [ NeighbourIndex ].RemoveSingleSwap ( IndexB );
+
+					if ( NeighbourIndex != IndexA )
 					{
-						PushData ( );
+						BoxNeighbourList [ NeighbourIndex ].AddUnique ( IndexA );
+						BoxNeighbourList [ IndexA ].AddUnique ( NeighbourIndex );
 					}
 				}
+
+				BoxNeighbourList [ IndexB ].Empty ( );
+
+				for ( const int32 NeighbourIndex : BoxNeighbourList [ IndexA ] )
+				{
+					PushPair ( IndexA , NeighbourIndex );
+				}
 			}
-		}
 
-		if ( IsBatchValid )
-		{
-			PushData ( );
-		}
+			TArray < TPair < FIntVector , FIntVector > > MergedBoxList;
 
-		if ( Progress.Cancelled ( ) )
-		{
-			return;
+			MergedBoxList.Reserve ( AliveCount );
+
+			for ( int32 BoxIndex = 0 ; BoxIndex < BoxList.Num ( ) ; ++BoxIndex )
+			{
+				if ( BoxAliveList [ BoxIndex ] )
+				{
+					MergedBoxList.Add ( BoxList [ BoxIndex ] );
+				}
+			}
+
+			BoxList = MoveTemp ( MergedBoxList );
 		}
 
 		/** Add To Result */
-		for ( const auto& BatchData : BatchDataMap )
+		ThreadData->CollisionBoxElems.Reserve ( BoxList.Num ( ) );
+
+		for ( const TPair < FIntVector , FIntVector >& Box : BoxList )
 		{
-			const FVector MinPos = FVector ( BatchData.Value ) * MeshGapSize;
-			const FVector MaxPos = FVector ( BatchData.Key + FIntVector ( 1 ) ) * MeshGapSize;
+			const FVector MinPos = FVector ( Box.Key - FIntVector ( 1 ) ) * MeshGapSize;
+			const FVector MaxPos = FVector ( Box.Value - FIntVector ( 1 ) ) * MeshGapSize;
 			const FVector Scale  = ( MaxPos - MinPos );
 			const FVector Center = FMath::Lerp ( MinPos , MaxPos , 0.5f ) - MeshBoundHalfSize;
 
@@ -1154,6 +3495,36 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_Completed ( TUniquePtr <
 				return;
 			}
 
+			if ( NewThreadData->bIsSkipOnEmpty || NewThreadData->bIsSkipOnFull )
+			{
+				const bool bIsSkipOnFull            = NewThreadData->bIsSkipOnFull;
+				const bool bIsUpdateNeededAgainTemp = bIsMeshUpdateNeededAgain;
+
+				{
+					FScopeLock DataLock ( &NewThreadDataSection );
+
+					ReleaseThreadData ( MoveTemp ( NewThreadData ) );
+				}
+
+				ClearRender ( );
+
+				if ( bIsSkipOnFull )
+				{
+					OnMeshSkipOnFull.Broadcast ( this );
+				}
+				else
+				{
+					OnMeshSkipOnEmpty.Broadcast ( this );
+				}
+
+				if ( bIsUpdateNeededAgainTemp )
+				{
+					UpdateRender ( );
+				}
+
+				return;
+			}
+
 			{
 				FScopeLock DataLock ( &NewThreadDataSection );
 				FScopeLock RenderLock ( &RenderDataLock );
@@ -1167,13 +3538,45 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_Completed ( TUniquePtr <
 				FKAggregateGeom           NewAgg;
 				FLPPDynamicMeshRenderData NewRenderData;
 
-				NewAgg.BoxElems = MoveTemp ( NewThreadData->CollisionBoxElems );
+				// Same solid as the current mesh, its Lumen card and collision is still right
+				const bool bIsReuseSolidData = NewThreadData->bIsSolidUnchanged && MeshRenderData.IsValid ( ) && MeshRenderData->LumenCardData.IsValid ( ) && NewThreadData->SolidCache.IsSame ( CommittedSolidCache );
+
+				// Worker compare with a job that was never commit, card and collision is missing so rebuild it all
+				if ( NewThreadData->bIsSolidUnchanged && bIsReuseSolidData == false )
+				{
+					bIsFullRebuildPending    = true;
+					bIsMeshUpdateNeededAgain = true;
+				}
+
+				CommittedSolidCache = NewThreadData->SolidCache;
+
+				if ( bIsReuseSolidData )
+				{
+					NewAgg = AggGeom;
+				}
+				else
+				{
+					NewAgg.BoxElems = MoveTemp ( NewThreadData->CollisionBoxElems );
+				}
 
 				{
 					NewRenderData.MeshData      = MakePimpl < FDynamicMesh3 > ( MoveTemp ( NewThreadData->MeshData ) );
-					NewRenderData.LumenCardData = MakeShared < FCardRepresentationData > ( );
 
-					NewRenderData.LumenCardData->MeshCardsBuildData = MoveTemp ( NewThreadData->LumenCardData );
+					if ( NewThreadData->StreamData.IsEmpty ( ) == false )
+					{
+						NewRenderData.StreamData = MakePimpl < FLPPDynamicMeshStreamData > ( MoveTemp ( NewThreadData->StreamData ) );
+					}
+
+					if ( bIsReuseSolidData )
+					{
+						NewRenderData.LumenCardData = MeshRenderData->LumenCardData;
+					}
+					else
+					{
+						NewRenderData.LumenCardData = MakeShared < FCardRepresentationData > ( );
+
+						NewRenderData.LumenCardData->MeshCardsBuildData = MoveTemp ( NewThreadData->LumenCardData );
+					}
 
 					if ( NewThreadData->bIsNaniteValid )
 					{
@@ -1188,13 +3591,14 @@ void ULPPMarchingMeshComponent::ComputeNewMarchingMesh_Completed ( TUniquePtr <
 				SetMesh ( MoveTemp ( NewRenderData ) , MoveTemp ( NewAgg ) );
 			}
 
-			NewThreadData.Reset ( );
+			ReleaseThreadData ( MoveTemp ( NewThreadData ) );
 
 			OnMeshGenerated.Broadcast ( this );
 
+			// Change that arrive while the job run is already in the pending dirty block
 			if ( bIsMeshUpdateNeededAgain )
 			{
-				UpdateRender ( );
+				QueueRebuild ( );
 			}
 		} );
 	}
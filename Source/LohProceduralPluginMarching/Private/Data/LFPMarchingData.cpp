@@ -3,12 +3,14 @@
 #include "Data/LPPMarchingData.h"
 
 #include "StaticMeshLODResourcesToDynamicMesh.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
 #include "DynamicMesh/Operations/MergeCoincidentMeshEdges.h"
 #include "Library/LPPMarchingFunctionLibrary.h"
 
 void ULPPMarchingData::PostLoad ( )
 {
 	GenerateDynamicMeshList ( );
+	GenerateBakedTileList ( );
 
 	Super::PostLoad ( );
 }
@@ -25,6 +27,17 @@ FLFPMarchingMeshMappingDataV2 ULPPMarchingData::GetMappingData ( const uint8 Mar
 	       : FLFPMarchingMeshMappingDataV2 ( );
 }
 
+#if WITH_DEV_AUTOMATION_TESTS
+void ULPPMarchingData::SetupTestTileList ( const FIntVector& NewMarchingSize , TArray < FDynamicMesh3 >&& NewDynamicMeshList , const TMap < uint8 , FLFPMarchingMeshMappingDataV2 >& NewMappingDataList )
+{
+	MarchingSize    = NewMarchingSize;
+	DynamicMeshList = MoveTemp ( NewDynamicMeshList );
+	MappingDataList = NewMappingDataList;
+
+	GenerateBakedTileList ( );
+}
+#endif
+
 #if WITH_EDITOR
 void ULPPMarchingData::AutoFillRotationList ( )
 {
@@ -98,6 +111,8 @@ void ULPPMarchingData::AutoFillMappingDataList ( )
 	}
 
 	MappingDataList.KeySort ( [] ( const uint8 KeyA , const uint8 KeyB ) { return KeyA < KeyB; } );
+
+	GenerateBakedTileList ( );
 }
 
 #endif
@@ -183,3 +198,199 @@ void ULPPMarchingData::GenerateDynamicMeshList ( )
 	}
 #endif
 }
+
+void ULPPMarchingData::GenerateBakedTileList ( )
+{
+	BakedTileList.Reset ( );
+	BakedTileList.SetNum ( 256 );
+
+	// Every tile fill the same cell, so the largest source bound is the cell face
+	float TileHalfSize = 0.0f;
+
+	for ( const FDynamicMesh3& SourceMesh : DynamicMeshList )
+	{
+		if ( SourceMesh.TriangleCount ( ) > 0 )
+		{
+			const UE::Geometry::FAxisAlignedBox3d SourceBound = SourceMesh.GetBounds ( );
+
+			TileHalfSize = FMath::Max ( TileHalfSize , static_cast < float > ( FMath::Max ( SourceBound.Min.GetAbsMax ( ) , SourceBound.Max.GetAbsMax ( ) ) ) );
+		}
+	}
+
+	const float BorderTolerance = TileHalfSize * 0.01f;
+
+	for ( int32 MarchingID = 0 ; MarchingID < 256 ; ++MarchingID )
+	{
+		const FLFPMarchingMeshMappingDataV2* MappingDataPtr = MappingDataList.Find ( MarchingID );
+
+		if ( MappingDataPtr == nullptr || MappingDataPtr->MeshID == INDEX_NONE )
+		{
+			continue;
+		}
+
+		const FDynamicMesh3* SourceMesh = GetDynamicMesh ( MappingDataPtr->MeshID );
+
+		if ( SourceMesh == nullptr || SourceMesh->TriangleCount ( ) == 0 )
+		{
+			continue;
+		}
+
+		const UE::Geometry::FDynamicMeshNormalOverlay*     NormalOverlay     = SourceMesh->HasAttributes ( ) ? SourceMesh->Attributes ( )->PrimaryNormals ( ) : nullptr;
+		const UE::Geometry::FDynamicMeshUVOverlay*         UVOverlay         = SourceMesh->HasAttributes ( ) ? SourceMesh->Attributes ( )->PrimaryUV ( ) : nullptr;
+		const UE::Geometry::FDynamicMeshMaterialAttribute* MaterialAttribute = SourceMesh->HasAttributes ( ) ? SourceMesh->Attributes ( )->GetMaterialID ( ) : nullptr;
+
+		// Rotation only, so winding never need to flip
+		const UE::Geometry::FTransformSRT3d RotateTransform ( FTransform ( MappingDataPtr->GetRotation ( ) ) );
+
+		FLPPMarchingBakedTile& BakedTile = BakedTileList [ MarchingID ];
+
+		TMap < int32 , int32 > VertexMap;
+		TMap < int32 , int32 > NormalMap;
+		TMap < int32 , int32 > UVMap;
+
+		BakedTile.TriangleList.Reserve ( SourceMesh->TriangleCount ( ) );
+		BakedTile.TriangleNormalList.Reserve ( SourceMesh->TriangleCount ( ) );
+		BakedTile.TriangleUVList.Reserve ( SourceMesh->TriangleCount ( ) );
+		BakedTile.MaterialIDList.Reserve ( SourceMesh->TriangleCount ( ) );
+		BakedTile.GroupIDList.Reserve ( SourceMesh->TriangleCount ( ) );
+
+		for ( const int32 TriangleID : SourceMesh->TriangleIndicesItr ( ) )
+		{
+			const UE::Geometry::FIndex3i TriangleVertex = SourceMesh->GetTriangle ( TriangleID );
+
+			FIntVector3 NewTriangle;
+			FIntVector3 NewTriangleNormal ( INDEX_NONE );
+			FIntVector3 NewTriangleUV ( INDEX_NONE );
+
+			for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+			{
+				if ( const int32* VertexIndexPtr = VertexMap.Find ( TriangleVertex [ Corner ] ) ; VertexIndexPtr != nullptr )
+				{
+					NewTriangle [ Corner ] = *VertexIndexPtr;
+				}
+				else
+				{
+					NewTriangle [ Corner ] = BakedTile.PositionList.Add ( FVector3f ( RotateTransform.TransformPosition ( SourceMesh->GetVertex ( TriangleVertex [ Corner ] ) ) ) );
+
+					VertexMap.Add ( TriangleVertex [ Corner ] , NewTriangle [ Corner ] );
+				}
+			}
+
+			if ( NormalOverlay != nullptr && NormalOverlay->IsSetTriangle ( TriangleID ) )
+			{
+				const UE::Geometry::FIndex3i TriangleElement = NormalOverlay->GetTriangle ( TriangleID );
+
+				for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+				{
+					if ( const int32* NormalIndexPtr = NormalMap.Find ( TriangleElement [ Corner ] ) ; NormalIndexPtr != nullptr )
+					{
+						NewTriangleNormal [ Corner ] = *NormalIndexPtr;
+					}
+					else
+					{
+						NewTriangleNormal [ Corner ] = BakedTile.NormalList.Add ( FVector3f ( RotateTransform.TransformNormal ( FVector3d ( NormalOverlay->GetElement ( TriangleElement [ Corner ] ) ) ) ) );
+
+						NormalMap.Add ( TriangleElement [ Corner ] , NewTriangleNormal [ Corner ] );
+					}
+				}
+			}
+
+			if ( UVOverlay != nullptr && UVOverlay->IsSetTriangle ( TriangleID ) )
+			{
+				const UE::Geometry::FIndex3i TriangleElement = UVOverlay->GetTriangle ( TriangleID );
+
+				for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+				{
+					if ( const int32* UVIndexPtr = UVMap.Find ( TriangleElement [ Corner ] ) ; UVIndexPtr != nullptr )
+					{
+						NewTriangleUV [ Corner ] = *UVIndexPtr;
+					}
+					else
+					{
+						NewTriangleUV [ Corner ] = BakedTile.UVList.Add ( UVOverlay->GetElement ( TriangleElement [ Corner ] ) );
+
+						UVMap.Add ( TriangleElement [ Corner ] , NewTriangleUV [ Corner ] );
+					}
+				}
+			}
+
+			BakedTile.TriangleList.Add ( NewTriangle );
+			BakedTile.TriangleNormalList.Add ( NewTriangleNormal );
+			BakedTile.TriangleUVList.Add ( NewTriangleUV );
+			BakedTile.MaterialIDList.Add ( MaterialAttribute != nullptr ? MaterialAttribute->GetValue ( TriangleID ) : 0 );
+			BakedTile.GroupIDList.Add ( SourceMesh->GetTriangleGroup ( TriangleID ) );
+		}
+
+		// Triangle without source normal get area weight vertex normal, so mesher never need to recompute
+		{
+			TArray < int32 > FillNormalList;
+
+			FillNormalList.Init ( INDEX_NONE , BakedTile.PositionList.Num ( ) );
+
+			for ( int32 TriangleIndex = 0 ; TriangleIndex < BakedTile.TriangleList.Num ( ) ; ++TriangleIndex )
+			{
+				if ( BakedTile.TriangleNormalList [ TriangleIndex ].X != INDEX_NONE )
+				{
+					continue;
+				}
+
+				const FIntVector3& Triangle = BakedTile.TriangleList [ TriangleIndex ];
+
+				for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+				{
+					if ( FillNormalList [ Triangle [ Corner ] ] == INDEX_NONE )
+					{
+						FillNormalList [ Triangle [ Corner ] ] = BakedTile.NormalList.Add ( FVector3f::ZeroVector );
+					}
+				}
+			}
+
+			for ( int32 TriangleIndex = 0 ; TriangleIndex < BakedTile.TriangleList.Num ( ) ; ++TriangleIndex )
+			{
+				const FIntVector3& Triangle = BakedTile.TriangleList [ TriangleIndex ];
+
+				// Left hand winding , not normalize so large triangle weight more
+				const FVector3f AreaNormal = ( BakedTile.PositionList [ Triangle.Z ] - BakedTile.PositionList [ Triangle.X ] ) ^ ( BakedTile.PositionList [ Triangle.Y ] - BakedTile.PositionList [ Triangle.X ] );
+
+				for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+				{
+					if ( FillNormalList [ Triangle [ Corner ] ] != INDEX_NONE )
+					{
+						BakedTile.NormalList [ FillNormalList [ Triangle [ Corner ] ] ] += AreaNormal;
+					}
+				}
+			}
+
+			for ( int32 TriangleIndex = 0 ; TriangleIndex < BakedTile.TriangleList.Num ( ) ; ++TriangleIndex )
+			{
+				if ( FIntVector3& TriangleNormal = BakedTile.TriangleNormalList [ TriangleIndex ] ; TriangleNormal.X == INDEX_NONE )
+				{
+					const FIntVector3& Triangle = BakedTile.TriangleList [ TriangleIndex ];
+
+					TriangleNormal = FIntVector3 ( FillNormalList [ Triangle.X ] , FillNormalList [ Triangle.Y ] , FillNormalList [ Triangle.Z ] );
+				}
+			}
+
+			for ( const int32 NormalIndex : FillNormalList )
+			{
+				if ( NormalIndex != INDEX_NONE )
+				{
+					BakedTile.NormalList [ NormalIndex ] = BakedTile.NormalList [ NormalIndex ].GetSafeNormal ( UE_SMALL_NUMBER , FVector3f::UpVector );
+				}
+			}
+		}
+
+		BakedTile.BorderNormalList.Init ( false , BakedTile.NormalList.Num ( ) );
+
+		for ( int32 TriangleIndex = 0 ; TriangleIndex < BakedTile.TriangleList.Num ( ) ; ++TriangleIndex )
+		{
+			for ( int32 Corner = 0 ; Corner < 3 ; ++Corner )
+			{
+				if ( BakedTile.PositionList [ BakedTile.TriangleList [ TriangleIndex ] [ Corner ] ].GetAbsMax ( ) >= TileHalfSize - BorderTolerance )
+				{
+					BakedTile.BorderNormalList [ BakedTile.TriangleNormalList [ TriangleIndex ] [ Corner ] ] = true;
+				}
+			}
+		}
+	}
+}
@@ -5,6 +5,9 @@
 
 #include "Library/LPPMarchingFunctionLibrary.h"
 
+#include "Data/LPPMarchingData.h"
+#include "Math/LFPGridLibrary.h"
+
 bool ULPPMarchingFunctionLibrary::GetMarchingIDBit( const uint8 MarchingID , const int32 BitIndex )
 {
 	check(BitIndex >= 0 || BitIndex <= 7);
@@ -324,4 +327,165 @@ uint8 ULPPMarchingFunctionLibrary::CalculateDualGridMarchingID( const uint8 Full
 	}
 
 	return FullMarchingID & CurrentFilter;
-}
\ No newline at end of file
+}
+
+FString ULPPMarchingFunctionLibrary::BenchmarkMarchingMesh( ULPPMarchingData* RenderSetting , const FGameplayTag HandleTag , const FIntVector DataSize , const int32 Seed , const float FillRatio , const ELPPMarchingMesherType MesherType , const int32 IterationCount )
+{
+	if ( IsValid(RenderSetting) == false || HandleTag.IsValid() == false || DataSize.GetMin() <= 0 || IterationCount <= 0 )
+	{
+		UE_LOG(LogTemp , Error , TEXT("BenchmarkMarchingMesh : Invalid Input") );
+
+		return FString();
+	}
+
+	FLPPMarchingCellSnapshot CellSnapshot;
+
+	CreateBenchmarkSnapshot(CellSnapshot , HandleTag , DataSize , Seed , FillRatio);
+
+	FLFPMarchingPassData PassData;
+
+	PassData.bRenderData             = true;
+	PassData.bSimpleBoxCollisionData = true;
+	PassData.MesherType              = MesherType;
+	PassData.MeshFullSize            = RenderSetting->GetMarchingSize();
+	PassData.DataSize                = DataSize;
+
+	FLPPMarchingLayerSetting& LayerSetting = PassData.LayerList.AddDefaulted_GetRef();
+
+	LayerSetting.HandleTag     = HandleTag;
+	LayerSetting.RenderSetting = RenderSetting;
+
+	FLPPMarchingStageTiming TimingSum;
+
+	FLPPMarchingMeshHash MeshHash;
+
+	for ( int32 Iteration = 0 ; Iteration < IterationCount ; ++Iteration )
+	{
+		// Fresh cache so every iteration is a full rebuild
+		PassData.StreamBlockCache = MesherType == ELPPMarchingMesherType::VertexStream ? MakeShared < FLPPMarchingStreamBlockCache , ESPMode::ThreadSafe >() : nullptr;
+
+		TUniquePtr < FLFPMarchingThreadData > ThreadData = MakeUnique < FLFPMarchingThreadData >();
+
+		ComputeMarchingMesh(ThreadData , CellSnapshot , PassData);
+
+		TimingSum.Classify += ThreadData->StageTiming.Classify;
+		TimingSum.MarchingID += ThreadData->StageTiming.MarchingID;
+		TimingSum.Mesh += ThreadData->StageTiming.Mesh;
+		TimingSum.Lumen += ThreadData->StageTiming.Lumen;
+		TimingSum.Collision += ThreadData->StageTiming.Collision;
+		TimingSum.Total += ThreadData->StageTiming.Total;
+
+		if ( Iteration != 0 )
+		{
+			continue;
+		}
+
+		// Output is deterministic, hash the first run only
+		MeshHash = GetMarchingMeshHash(*ThreadData);
+	}
+
+	const double ToAverageMs = 1000.0 / IterationCount;
+
+	return FString::Printf(
+		TEXT("{\"DataSize\":[%d,%d,%d],\"Seed\":%d,\"FillRatio\":%f,\"MesherType\":%d,\"IterationCount\":%d,")
+		TEXT("\"VertexCount\":%d,\"TriangleCount\":%d,\"MeshHash\":%u,\"CollisionHash\":%u,\"LumenHash\":%u,")
+		TEXT("\"StageMs\":{\"Classify\":%f,\"MarchingID\":%f,\"Mesh\":%f,\"Lumen\":%f,\"Collision\":%f,\"Total\":%f}}") ,
+		DataSize.X , DataSize.Y , DataSize.Z , Seed , FillRatio , static_cast < int32 >(MesherType) , IterationCount ,
+		MeshHash.VertexCount , MeshHash.TriangleCount , MeshHash.MeshHash , MeshHash.CollisionHash , MeshHash.LumenHash ,
+		TimingSum.Classify * ToAverageMs , TimingSum.MarchingID * ToAverageMs , TimingSum.Mesh * ToAverageMs , TimingSum.Lumen * ToAverageMs , TimingSum.Collision * ToAverageMs , TimingSum.Total * ToAverageMs
+		);
+}
+
+void ULPPMarchingFunctionLibrary::ComputeMarchingMesh( TUniquePtr < FLFPMarchingThreadData >& ThreadData , const FLPPMarchingCellSnapshot& CellSnapshot , const FLFPMarchingPassData& PassData )
+{
+	FProgressCancel Progress;
+
+	ULPPMarchingMeshComponent::ComputeNewMarchingMesh_TaskFunction(ThreadData , Progress , CellSnapshot , PassData);
+}
+
+void ULPPMarchingFunctionLibrary::CreateBenchmarkSnapshot( FLPPMarchingCellSnapshot& OutSnapshot , const FGameplayTag HandleTag , const FIntVector DataSize , const int32 Seed , const float FillRatio )
+{
+	FRandomStream RandomStream(Seed);
+
+	OutSnapshot.Size = DataSize + FIntVector(2);
+	OutSnapshot.PaletteIndexList.SetNumZeroed(OutSnapshot.Size.X * OutSnapshot.Size.Y * OutSnapshot.Size.Z);
+
+	OutSnapshot.Palette.FindOrAdd(FGameplayTag::EmptyTag);
+
+	const uint16 SolidPaletteIndex = OutSnapshot.Palette.FindOrAdd(HandleTag);
+
+	for ( int32 CellIndex = 0 ; CellIndex < OutSnapshot.PaletteIndexList.Num() ; ++CellIndex )
+	{
+		const FIntVector CellLocation = ULFPGridLibrary::ToGridLocation(CellIndex , OutSnapshot.Size);
+
+		bool bIsSolid = false;
+
+		if ( FillRatio > 0.0f )
+		{
+			bIsSolid = RandomStream.FRand() < FillRatio;
+		}
+		else
+		{
+			// Structured : seeded wave height field
+			const float Height = OutSnapshot.Size.Z * ( 0.5f + 0.25f * FMath::Sin(( CellLocation.X + Seed ) * 0.3f) * FMath::Cos(( CellLocation.Y - Seed ) * 0.2f) );
+
+			bIsSolid = CellLocation.Z < Height;
+		}
+
+		OutSnapshot.PaletteIndexList[CellIndex] = bIsSolid ? SolidPaletteIndex : 0;
+	}
+}
+
+FLPPMarchingMeshHash ULPPMarchingFunctionLibrary::GetMarchingMeshHash( const FLFPMarchingThreadData& ThreadData )
+{
+	FLPPMarchingMeshHash MeshHash;
+
+	if ( ThreadData.StreamData.IsEmpty() == false )
+	{
+		const FLPPDynamicMeshStreamData& StreamData = ThreadData.StreamData;
+
+		MeshHash.MeshHash = FCrc::MemCrc32(StreamData.PositionList.GetData() , StreamData.PositionList.Num() * StreamData.PositionList.GetTypeSize());
+		MeshHash.MeshHash = FCrc::MemCrc32(StreamData.IndexList.GetData() , StreamData.IndexList.Num() * StreamData.IndexList.GetTypeSize() , MeshHash.MeshHash);
+		MeshHash.MeshHash = FCrc::MemCrc32(StreamData.MaterialList.GetData() , StreamData.MaterialList.Num() * StreamData.MaterialList.GetTypeSize() , MeshHash.MeshHash);
+
+		MeshHash.VertexCount   = StreamData.PositionList.Num();
+		MeshHash.TriangleCount = StreamData.TriangleCount();
+	}
+	else
+	{
+		const FDynamicMesh3& MeshData = ThreadData.MeshData;
+
+		for ( const int32 VertexID : MeshData.VertexIndicesItr() )
+		{
+			const FVector3f Position = FVector3f(MeshData.GetVertex(VertexID));
+
+			MeshHash.MeshHash = FCrc::MemCrc32(&Position , sizeof(FVector3f) , MeshHash.MeshHash);
+		}
+
+		for ( const int32 TriangleID : MeshData.TriangleIndicesItr() )
+		{
+			const UE::Geometry::FIndex3i Triangle = MeshData.GetTriangle(TriangleID);
+
+			MeshHash.MeshHash = FCrc::MemCrc32(&Triangle , sizeof(UE::Geometry::FIndex3i) , MeshHash.MeshHash);
+		}
+
+		MeshHash.VertexCount   = MeshData.VertexCount();
+		MeshHash.TriangleCount = MeshData.TriangleCount();
+	}
+
+	for ( const FKBoxElem& BoxElem : ThreadData.CollisionBoxElems )
+	{
+		const FVector BoxData[2] = { BoxElem.Center , FVector(BoxElem.X , BoxElem.Y , BoxElem.Z) };
+
+		MeshHash.CollisionHash = FCrc::MemCrc32(BoxData , sizeof(BoxData) , MeshHash.CollisionHash);
+	}
+
+	for ( const FLumenCardBuildData& CardData : ThreadData.LumenCardData.CardBuildData )
+	{
+		const FVector3f CardBox[2] = { CardData.OBB.Origin , CardData.OBB.Extent };
+
+		MeshHash.LumenHash = FCrc::MemCrc32(CardBox , sizeof(CardBox) , MeshHash.LumenHash);
+	}
+
+	return MeshHash;
+}
@@ -0,0 +1,217 @@
+﻿// Copyright (c) 2025 Loh Zhi Kang ( loh0123@hotmail.com )
+//
+// Distributed under the MIT License (MIT) (See accompanying file LICENSE.txt
+// or copy at http://opensource.org/licenses/MIT)
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "NativeGameplayTags.h"
+#include "Components/LPPMarchingMeshComponent.h"
+#include "Data/LPPMarchingData.h"
+#include "DynamicMesh/Operations/MergeCoincidentMeshEdges.h"
+#include "Library/LPPMarchingFunctionLibrary.h"
+#include "Math/LFPGridLibrary.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC ( TAG_LPPMarchingTest_Solid , "LPP.Test.MarchingSolid" );
+
+namespace LPPMarchingMeshTest
+{
+	/* Solid corner fill its octant of the cell, face is only add toward an empty octant so neighbour tile meet on the cell face */
+	ULPPMarchingData* CreateOctantTileData ( const int32 TileSize )
+	{
+		const double HalfSize = TileSize * 0.5;
+
+		TArray < FDynamicMesh3 >                       TileMeshList;
+		TMap < uint8 , FLFPMarchingMeshMappingDataV2 > MappingDataList;
+
+		TileMeshList.SetNum ( 256 );
+
+		for ( int32 MarchingID = 1 ; MarchingID < 255 ; ++MarchingID )
+		{
+			FDynamicMesh3& TileMesh = TileMeshList [ MarchingID ];
+
+			for ( int32 CornerIndex = 0 ; CornerIndex < 8 ; ++CornerIndex )
+			{
+				if ( ( MarchingID & ( 1 << CornerIndex ) ) == 0 )
+				{
+					continue;
+				}
+
+				// Same corner order as GetMarchingID, X is bit 0
+				const FIntVector Corner ( CornerIndex & 1 , ( CornerIndex >> 1 ) & 1 , ( CornerIndex >> 2 ) & 1 );
+
+				for ( int32 Axis = 0 ; Axis < 3 ; ++Axis )
+				{
+					// Solid neighbour octant hide this face
+					if ( ( MarchingID & ( 1 << ( CornerIndex ^ ( 1 << Axis ) ) ) ) != 0 )
+					{
+						continue;
+					}
+
+					const int32 AxisU = ( Axis + 1 ) % 3;
+					const int32 AxisV = ( Axis + 2 ) % 3;
+
+					int32 QuadVertexList [ 4 ];
+
+					for ( int32 QuadIndex = 0 ; QuadIndex < 4 ; ++QuadIndex )
+					{
+						const int32 StepU = QuadIndex == 1 || QuadIndex == 2 ? 1 : 0;
+						const int32 StepV = QuadIndex >= 2 ? 1 : 0;
+
+						FVector3d Position = FVector3d::ZeroVector;
+
+						Position [ AxisU ] = ( Corner [ AxisU ] - 1 + StepU ) * HalfSize;
+						Position [ AxisV ] = ( Corner [ AxisV ] - 1 + StepV ) * HalfSize;
+
+						QuadVertexList [ QuadIndex ] = TileMesh.AppendVertex ( Position );
+					}
+
+					// Face point from the solid octant to the empty one
+					if ( Corner [ Axis ] == 0 )
+					{
+						TileMesh.AppendTriangle ( QuadVertexList [ 0 ] , QuadVertexList [ 1 ] , QuadVertexList [ 2 ] );
+						TileMesh.AppendTriangle ( QuadVertexList [ 0 ] , QuadVertexList [ 2 ] , QuadVertexList [ 3 ] );
+					}
+					else
+					{
+						TileMesh.AppendTriangle ( QuadVertexList [ 0 ] , QuadVertexList [ 2 ] , QuadVertexList [ 1 ] );
+						TileMesh.AppendTriangle ( QuadVertexList [ 0 ] , QuadVertexList [ 3 ] , QuadVertexList [ 2 ] );
+					}
+				}
+			}
+
+			MappingDataList.Add ( MarchingID , FLFPMarchingMeshMappingDataV2 ( MarchingID , FIntVector ( 0 ) ) );
+		}
+
+		ULPPMarchingData* TileData = NewObject < ULPPMarchingData > ( GetTransientPackage ( ) );
+
+		TileData->SetupTestTileList ( FIntVector ( TileSize ) , MoveTemp ( TileMeshList ) , MappingDataList );
+
+		return TileData;
+	}
+
+	/* Height only rise along X and Y, so no two solid cell touch on an edge alone and the mesh stay manifold */
+	void CreateStairSnapshot ( FLPPMarchingCellSnapshot& OutSnapshot , const FIntVector& DataSize )
+	{
+		OutSnapshot.Size = DataSize + FIntVector ( 2 );
+		OutSnapshot.PaletteIndexList.SetNumZeroed ( OutSnapshot.Size.X * OutSnapshot.Size.Y * OutSnapshot.Size.Z );
+
+		OutSnapshot.Palette.FindOrAdd ( FGameplayTag::EmptyTag );
+
+		const uint16 SolidPaletteIndex = OutSnapshot.Palette.FindOrAdd ( TAG_LPPMarchingTest_Solid );
+
+		for ( int32 CellIndex = 0 ; CellIndex < OutSnapshot.PaletteIndexList.Num ( ) ; ++CellIndex )
+		{
+			const FIntVector CellLocation = ULFPGridLibrary::ToGridLocation ( CellIndex , OutSnapshot.Size );
+
+			if ( CellLocation.Z < 3 + ( CellLocation.X + CellLocation.Y ) / 3 )
+			{
+				OutSnapshot.PaletteIndexList [ CellIndex ] = SolidPaletteIndex;
+			}
+		}
+	}
+
+	FLFPMarchingPassData CreatePassData ( ULPPMarchingData* TileData , const FIntVector& DataSize , const ELPPMarchingMesherType MesherType )
+	{
+		FLFPMarchingPassData PassData;
+
+		PassData.bRenderData             = true;
+		PassData.bSimpleBoxCollisionData = true;
+		PassData.MesherType              = MesherType;
+		PassData.MeshFullSize            = TileData->GetMarchingSize ( );
+		PassData.DataSize                = DataSize;
+
+		// Fresh cache so the run is always a full rebuild
+		PassData.StreamBlockCache = MesherType == ELPPMarchingMesherType::VertexStream ? MakeShared < FLPPMarchingStreamBlockCache , ESPMode::ThreadSafe > ( ) : nullptr;
+
+		FLPPMarchingLayerSetting& LayerSetting = PassData.LayerList.AddDefaulted_GetRef ( );
+
+		LayerSetting.HandleTag     = TAG_LPPMarchingTest_Solid;
+		LayerSetting.RenderSetting = TileData;
+
+		return PassData;
+	}
+
+	/* Unwelded duplicate from the non manifold fallback can leave unused vertex behind */
+	int32 CountUsedVertex ( const FDynamicMesh3& Mesh )
+	{
+		int32 VertexCount = 0;
+
+		for ( const int32 VertexID : Mesh.VertexIndicesItr ( ) )
+		{
+			VertexCount += Mesh.GetVtxEdgeCount ( VertexID ) > 0 ? 1 : 0;
+		}
+
+		return VertexCount;
+	}
+
+	int32 CountBoundaryEdge ( const FDynamicMesh3& Mesh )
+	{
+		int32 EdgeCount = 0;
+
+		for ( const int32 EdgeID : Mesh.EdgeIndicesItr ( ) )
+		{
+			EdgeCount += Mesh.IsBoundaryEdge ( EdgeID ) ? 1 : 0;
+		}
+
+		return EdgeCount;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST ( FLPPMarchingInlineWeldTest , "LohProceduralPlugin.Marching.InlineWeldMatchEdgeMerge" , EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter )
+
+bool FLPPMarchingInlineWeldTest::RunTest ( const FString& Parameters )
+{
+	const FIntVector DataSize ( 8 );
+
+	ULPPMarchingData* TileData = LPPMarchingMeshTest::CreateOctantTileData ( 100 );
+
+	FLPPMarchingCellSnapshot CellSnapshot;
+
+	LPPMarchingMeshTest::CreateStairSnapshot ( CellSnapshot , DataSize );
+
+	const FLFPMarchingPassData PassData = LPPMarchingMeshTest::CreatePassData ( TileData , DataSize , ELPPMarchingMesherType::DynamicMesh );
+
+	TUniquePtr < FLFPMarchingThreadData > ThreadData = MakeUnique < FLFPMarchingThreadData > ( );
+
+	ULPPMarchingFunctionLibrary::ComputeMarchingMesh ( ThreadData , CellSnapshot , PassData );
+
+	const FDynamicMesh3& WeldMesh = ThreadData->MeshData;
+
+	if ( TestTrue ( TEXT ( "Inline weld produce triangle" ) , WeldMesh.TriangleCount ( ) > 0 ) == false )
+	{
+		return false;
+	}
+
+	// Same triangle as an unwelded soup, then weld by the old whole mesh pass
+	FDynamicMesh3 MergeMesh;
+
+	for ( const int32 TriangleID : WeldMesh.TriangleIndicesItr ( ) )
+	{
+		const UE::Geometry::FIndex3i Triangle = WeldMesh.GetTriangle ( TriangleID );
+
+		MergeMesh.AppendTriangle (
+		                          MergeMesh.AppendVertex ( WeldMesh.GetVertex ( Triangle.A ) ) ,
+		                          MergeMesh.AppendVertex ( WeldMesh.GetVertex ( Triangle.B ) ) ,
+		                          MergeMesh.AppendVertex ( WeldMesh.GetVertex ( Triangle.C ) )
+		                         );
+	}
+
+	{
+		UE::Geometry::FMergeCoincidentMeshEdges Welder ( &MergeMesh );
+		Welder.MergeVertexTolerance = PassData.EdgeMergeDistance;
+		Welder.OnlyUniquePairs      = false;
+		Welder.Apply ( );
+	}
+
+	TestEqual ( TEXT ( "Vertex count" ) , LPPMarchingMeshTest::CountUsedVertex ( WeldMesh ) , LPPMarchingMeshTest::CountUsedVertex ( MergeMesh ) );
+	TestEqual ( TEXT ( "Triangle count" ) , WeldMesh.TriangleCount ( ) , MergeMesh.TriangleCount ( ) );
+	TestEqual ( TEXT ( "Boundary edge count" ) , LPPMarchingMeshTest::CountBoundaryEdge ( WeldMesh ) , LPPMarchingMeshTest::CountBoundaryEdge ( MergeMesh ) );
+
+	return true;
+}
+
+#endif
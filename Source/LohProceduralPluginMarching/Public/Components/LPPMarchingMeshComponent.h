@@ -10,6 +10,8 @@
 #include "MeshCardBuild.h"
 #include "Components/BaseDynamicMeshComponent.h"
 #include "Components/LPPDynamicMesh.h"
+#include "Data/LPPDynamicMeshRenderData.h"
+#include "Interface/LPPChunkActorInterface.h"
 #include "Rendering/NaniteResources.h"
 #include "Subsystem/LPPProceduralWorldTaskSubsystem.h"
 #include "LPPMarchingMeshComponent.generated.h"
@@ -58,6 +60,351 @@ namespace LFPMarchingRenderConstantData
 	};
 };
 
+UENUM ( BlueprintType )
+enum class ELPPMarchingMesherType : uint8
+{
+	/* Append tile into FDynamicMesh3 with inline lattice weld, chunk edge cell is clip while the tile is emit, mesh serially on one worker */
+	DynamicMesh UMETA ( DisplayName = "Dynamic Mesh" ) ,
+
+	/* Write weld indexed stream directly, FDynamicMesh3 is only build when simplify or box UV need it, sub block is mesh in parallel and cache for UpdateRenderPartial */
+	VertexStream UMETA ( DisplayName = "Vertex Stream" ) ,
+
+	/* One vertex per surface cell and one quad per crossing edge, far less triangle than tile and no RenderSetting tile is use, mesh serially */
+	SurfaceNets UMETA ( DisplayName = "Surface Nets" ) ,
+
+	/* Blocky voxel face merge into quad per layer, cheapest mode for far or low importance chunk, mesh serially */
+	GreedyBlocky UMETA ( DisplayName = "Greedy Blocky" ) ,
+};
+
+UENUM ( BlueprintType )
+enum class ELPPMarchingSimplifyMethod : uint8
+{
+	/* Coplanar region is re-triangulate from its boundary, uv and normal seam is keep */
+	PlanarMerge UMETA ( DisplayName = "Planar Merge" ) ,
+
+	/* FQEMSimplification::SimplifyToMinimalPlanar then normal recompute, slow but handle any shape */
+	QEM UMETA ( DisplayName = "QEM" ) ,
+};
+
+UENUM ( BlueprintType )
+enum class ELPPMarchingLODReduction : uint8
+{
+	/* Coarse cell is solid when any cell inside is solid, keep thin wall */
+	AnySolid UMETA ( DisplayName = "Any Solid" ) ,
+
+	/* Coarse cell is solid when half or more cell inside is solid */
+	Majority UMETA ( DisplayName = "Majority" ) ,
+};
+
+/* Solid cache pack as 64 bit aligned X row per ( Y , Z ) so marching id and run can be read a word at a time */
+struct FLPPMarchingSolidCache
+{
+	FLPPMarchingSolidCache ( ) = default;
+
+	explicit FLPPMarchingSolidCache ( const FIntVector& InSize ) : Size ( InSize ), RowWordCount ( FMath::DivideAndRoundUp ( InSize.X , 64 ) )
+	{
+		WordList.SetNumZeroed ( RowWordCount * InSize.Y * InSize.Z );
+	}
+
+public:
+
+	FIntVector Size = FIntVector::ZeroValue;
+
+	int32 RowWordCount = 0;
+
+	TArray < uint64 > WordList = TArray < uint64 > ( );
+
+public:
+
+	FORCEINLINE int32 Num ( ) const
+	{
+		return Size.X * Size.Y * Size.Z;
+	}
+
+	FORCEINLINE const uint64* GetRow ( const int32 Y , const int32 Z ) const
+	{
+		return WordList.GetData ( ) + ( ( Y + ( Z * Size.Y ) ) * RowWordCount );
+	}
+
+	FORCEINLINE uint64* GetRow ( const int32 Y , const int32 Z )
+	{
+		return WordList.GetData ( ) + ( ( Y + ( Z * Size.Y ) ) * RowWordCount );
+	}
+
+	FORCEINLINE bool Get ( const int32 X , const int32 Y , const int32 Z ) const
+	{
+		return ( GetRow ( Y , Z ) [ X >> 6 ] >> ( X & 63 ) ) & 1;
+	}
+
+	FORCEINLINE bool Get ( const FIntVector& Location ) const
+	{
+		return Get ( Location.X , Location.Y , Location.Z );
+	}
+
+	FORCEINLINE void Set ( const int32 X , const int32 Y , const int32 Z )
+	{
+		GetRow ( Y , Z ) [ X >> 6 ] |= uint64 ( 1 ) << ( X & 63 );
+	}
+
+	/* Reduce Source by Step on every axis, apron cell is reduce only across the face so the LOD grid keep a one cell apron */
+	void InitDownsample ( const FLPPMarchingSolidCache& Source , const int32 Step , const ELPPMarchingLODReduction Reduction )
+	{
+		const FIntVector SourceDataSize = Source.Size - FIntVector ( 2 );
+
+		Init ( FIntVector ( SourceDataSize.X / Step , SourceDataSize.Y / Step , SourceDataSize.Z / Step ) + FIntVector ( 2 ) );
+
+		// Source range [ Min , Max ) of one coarse cell on one axis
+		const auto GetSourceRange = [&] ( const int32 Axis , const int32 Index )
+		{
+			if ( Index == 0 )
+			{
+				return FIntPoint ( 0 , 1 );
+			}
+
+			if ( Index == Size [ Axis ] - 1 )
+			{
+				return FIntPoint ( Source.Size [ Axis ] - 1 , Source.Size [ Axis ] );
+			}
+
+			return FIntPoint ( 1 + ( ( Index - 1 ) * Step ) , 1 + ( Index * Step ) );
+		};
+
+		for ( int32 Z = 0 ; Z < Size.Z ; ++Z )
+		{
+			const FIntPoint RangeZ = GetSourceRange ( 2 , Z );
+
+			for ( int32 Y = 0 ; Y < Size.Y ; ++Y )
+			{
+				const FIntPoint RangeY = GetSourceRange ( 1 , Y );
+
+				for ( int32 X = 0 ; X < Size.X ; ++X )
+				{
+					const FIntPoint RangeX = GetSourceRange ( 0 , X );
+
+					const int32 TotalCount = ( RangeX.Y - RangeX.X ) * ( RangeY.Y - RangeY.X ) * ( RangeZ.Y - RangeZ.X );
+
+					int32 SolidCount = 0;
+
+					for ( int32 SourceZ = RangeZ.X ; SourceZ < RangeZ.Y ; ++SourceZ )
+					{
+						for ( int32 SourceY = RangeY.X ; SourceY < RangeY.Y ; ++SourceY )
+						{
+							for ( int32 SourceX = RangeX.X ; SourceX < RangeX.Y ; ++SourceX )
+							{
+								SolidCount += Source.Get ( SourceX , SourceY , SourceZ ) ? 1 : 0;
+							}
+						}
+					}
+
+					if ( Reduction == ELPPMarchingLODReduction::AnySolid ? SolidCount > 0 : SolidCount * 2 >= TotalCount )
+					{
+						Set ( X , Y , Z );
+					}
+				}
+			}
+		}
+	}
+
+	/* Data cell is solid and the cell toward Direction is not, DataLocation skip the one cell apron */
+	FORCEINLINE bool IsFaceVisible ( const FIntVector& DataLocation , const FIntVector& Direction ) const
+	{
+		const FIntVector TargetCheckPos = DataLocation + FIntVector ( 1 );
+
+		return Get ( TargetCheckPos + Direction ) == false && Get ( TargetCheckPos );
+	}
+
+	/* Resize and clear, word capacity is keep */
+	void Init ( const FIntVector& InSize )
+	{
+		Size         = InSize;
+		RowWordCount = FMath::DivideAndRoundUp ( InSize.X , 64 );
+
+		WordList.Reset ( );
+		WordList.SetNumZeroed ( RowWordCount * InSize.Y * InSize.Z );
+	}
+
+	FORCEINLINE bool IsSame ( const FLPPMarchingSolidCache& Other ) const
+	{
+		return Size == Other.Size && WordList == Other.WordList;
+	}
+
+	/* Read 64 bit start from X, bit past the row end is zero */
+	FORCEINLINE uint64 GetWord ( const uint64* Row , const int32 X ) const
+	{
+		const int32 WordIndex = X >> 6;
+		const int32 BitIndex  = X & 63;
+
+		const uint64 LowWord = WordIndex < RowWordCount ? Row [ WordIndex ] : 0;
+
+		if ( BitIndex == 0 )
+		{
+			return LowWord;
+		}
+
+		const uint64 HighWord = WordIndex + 1 < RowWordCount ? Row [ WordIndex + 1 ] : 0;
+
+		return ( LowWord >> BitIndex ) | ( HighWord << ( 64 - BitIndex ) );
+	}
+
+	/* Return first X at or after StartX in the row that match bValue, Size.X if none */
+	int32 FindNext ( const uint64* Row , const int32 StartX , const bool bValue ) const
+	{
+		for ( int32 X = StartX ; X < Size.X ; X = ( X & ~63 ) + 64 )
+		{
+			uint64 Word = GetWord ( Row , X & ~63 );
+
+			if ( bValue == false )
+			{
+				Word = ~Word;
+			}
+
+			Word &= ~uint64 ( 0 ) << ( X & 63 );
+
+			if ( Word != 0 )
+			{
+				return FMath::Min ( ( X & ~63 ) + static_cast < int32 > ( FMath::CountTrailingZeros64 ( Word ) ) , Size.X );
+			}
+		}
+
+		return Size.X;
+	}
+
+	/* True when every X in [ StartX , EndX ) of the row is set */
+	bool IsRangeSet ( const uint64* Row , const int32 StartX , const int32 EndX ) const
+	{
+		for ( int32 X = StartX ; X < EndX ; X += 64 )
+		{
+			const int32  BitCount = FMath::Min ( EndX - X , 64 );
+			const uint64 Mask     = BitCount == 64 ? ~uint64 ( 0 ) : ( uint64 ( 1 ) << BitCount ) - 1;
+
+			if ( ( GetWord ( Row , X ) & Mask ) != Mask )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/* Clear every X in [ StartX , EndX ) of the row */
+	void ClearRange ( uint64* Row , const int32 StartX , const int32 EndX )
+	{
+		for ( int32 X = StartX ; X < EndX ; )
+		{
+			const int32  BitIndex = X & 63;
+			const int32  BitCount = FMath::Min ( EndX - X , 64 - BitIndex );
+			const uint64 Mask     = BitCount == 64 ? ~uint64 ( 0 ) : ( ( uint64 ( 1 ) << BitCount ) - 1 ) << BitIndex;
+
+			Row [ X >> 6 ] &= ~Mask;
+
+			X += BitCount;
+		}
+	}
+
+	int32 CountSolid ( ) const
+	{
+		int32 SolidCount = 0;
+
+		for ( const uint64 Word : WordList )
+		{
+			SolidCount += FMath::CountBits ( Word );
+		}
+
+		return SolidCount;
+	}
+};
+
+/* Distinct tag seen in one rebuild, chunk only use a few so MatchesTag is run per entry instead of per cell */
+struct FLPPMarchingTagPalette
+{
+	TArray < FGameplayTag > TagList = TArray < FGameplayTag > ( );
+
+	int32 LastIndex = INDEX_NONE;
+
+public:
+
+	/* Neighbour cell mostly share tag so last entry is check first */
+	FORCEINLINE uint16 FindOrAdd ( const FGameplayTag& Tag )
+	{
+		if ( TagList.IsValidIndex ( LastIndex ) == false || TagList [ LastIndex ] != Tag )
+		{
+			LastIndex = TagList.Find ( Tag );
+
+			if ( LastIndex == INDEX_NONE )
+			{
+				LastIndex = TagList.Add ( Tag );
+			}
+		}
+
+		return static_cast < uint16 > ( LastIndex );
+	}
+
+	/* Extend layer lookup to cover every palette entry, first matching layer win and INDEX_NONE is empty */
+	void UpdateLayerLookup ( TArray < int32 >& LayerLookup , const TArray < FGameplayTag >& HandleTagList ) const
+	{
+		for ( int32 PaletteIndex = LayerLookup.Num ( ) ; PaletteIndex < TagList.Num ( ) ; ++PaletteIndex )
+		{
+			LayerLookup.Add ( HandleTagList.IndexOfByPredicate ( [&] ( const FGameplayTag& HandleTag ) { return TagList [ PaletteIndex ].MatchesTag ( HandleTag ); } ) );
+		}
+	}
+};
+
+USTRUCT ( BlueprintType )
+struct FLPPMarchingLayerSetting
+{
+	GENERATED_BODY ( )
+
+public:
+
+	UPROPERTY ( EditAnywhere , BlueprintReadWrite , Category = "Default" )
+	FGameplayTag HandleTag = FGameplayTag::EmptyTag;
+
+	UPROPERTY ( EditAnywhere , BlueprintReadWrite , Category = "Default" )
+	TObjectPtr < ULPPMarchingData > RenderSetting = nullptr;
+
+	/* Add to the tile material id so each layer use its own material slot */
+	UPROPERTY ( EditAnywhere , BlueprintReadWrite , Category = "Default" , meta = ( ClampMin = 0 ) )
+	int32 MaterialOffset = 0;
+};
+
+/* Palette index of the chunk plus one cell apron, copy on game thread and classify on worker */
+struct FLPPMarchingCellSnapshot
+{
+	FIntVector Size = FIntVector::ZeroValue;
+
+	/* Entry 0 is empty tag, use by apron cell that can't be resolve */
+	FLPPMarchingTagPalette Palette = FLPPMarchingTagPalette ( );
+
+	TArray < uint16 > PaletteIndexList = TArray < uint16 > ( );
+};
+
+/* Vertex stream of one sub block, seam vertex is weld again when block is splice */
+struct FLPPMarchingStreamBlock
+{
+	FLPPDynamicMeshStreamData StreamData = FLPPDynamicMeshStreamData ( );
+
+	/* Vertex emit by cell on the block outer layer */
+	TBitArray < > SeamList = TBitArray < > ( );
+
+	/* Vertex carry a tile border normal */
+	TBitArray < > BorderList = TBitArray < > ( );
+};
+
+/* Keep between rebuild so only dirty sub block need to be mesh again */
+struct FLPPMarchingStreamBlockCache
+{
+	FIntVector BlockCount = FIntVector::ZeroValue;
+	int32      BlockSize  = 0;
+
+	/* False while a job is writing or after a cancel, next rebuild will be full */
+	bool bIsValid = false;
+
+	TArray < FLPPMarchingStreamBlock > BlockList = TArray < FLPPMarchingStreamBlock > ( );
+
+	/* Solid of the last complete job, Lumen card and collision only depend on it */
+	FLPPMarchingSolidCache SolidCache = FLPPMarchingSolidCache ( );
+};
+
 USTRUCT ( )
 struct FLFPMarchingPassData
 {
@@ -70,26 +417,47 @@ public:
 
 public:
 
-	bool       bRenderData       = false;
-	FVector    MeshFullSize      = FVector ( );
-	FIntVector DataSize          = FIntVector ( );
-	float      BoundExpand       = 0.0f;
-	float      EdgeMergeDistance = 0.1f;
+	bool                   bRenderData       = false;
+	ELPPMarchingMesherType MesherType        = ELPPMarchingMesherType::DynamicMesh;
+	FVector                MeshFullSize      = FVector ( );
+	FIntVector             DataSize          = FIntVector ( );
+	float                  BoundExpand       = 0.0f;
+	float                  EdgeMergeDistance = 0.1f;
+	float                  SeamNormalAngle   = 45.0f;
+
+	/* Only use by ELPPMarchingMesherType::VertexStream */
+	TSharedPtr < FLPPMarchingStreamBlockCache , ESPMode::ThreadSafe > StreamBlockCache = nullptr;
+
+	int32            SubBlockSize   = 8;
+	bool             bIsFullRebuild = true;
+	TArray < int32 > DirtyBlockList = TArray < int32 > ( );
+
+	/* Render mesh is build on a DataSize / ( 1 << LODIndex ) grid, Lumen card and collision stay on the full grid */
+	int32                    LODIndex          = 0;
+	ELPPMarchingLODReduction LODReduction      = ELPPMarchingLODReduction::AnySolid;
+	bool                     bGenerateLODSkirt = true;
 
 	bool bMostlyTwoSided = false;
 	bool bNaniteMesh     = false;
 
+	/* Zero is no limit */
+	int32 MaxLumenCardCount = 0;
+
 	FMeshNaniteSettings NaniteSetting = FMeshNaniteSettings ( );
 
 public:
 
-	bool  bSimplifyRenderData = false;
-	float SimplifyAngle       = 0.1f;
+	bool                       bSimplifyRenderData = false;
+	ELPPMarchingSimplifyMethod SimplifyMethod      = ELPPMarchingSimplifyMethod::PlanarMerge;
+	float                      SimplifyAngle       = 0.1f;
 
 public:
 
 	bool bSimpleBoxCollisionData = false;
 
+	/* Zero is no limit */
+	int32 MaxCollisionBoxCount = 0;
+
 public:
 
 	bool       bRecomputeBoxUV = false;
@@ -103,8 +471,37 @@ public:
 
 public:
 
+	/* Always at least one layer, cell is assign to the first layer it match */
 	UPROPERTY ( )
-	TObjectPtr < ULPPMarchingData > RenderSetting = nullptr;
+	TArray < FLPPMarchingLayerSetting > LayerList;
+};
+
+/* Wall time of each mesher stage in second, fill by the worker for profiling and benchmark */
+struct FLPPMarchingStageTiming
+{
+	double Classify   = 0.0;
+	double MarchingID = 0.0; // Part of Mesh
+	double Mesh       = 0.0;
+	double Lumen      = 0.0;
+	double Collision  = 0.0;
+	double Total      = 0.0;
+
+	struct FScope
+	{
+		explicit FScope ( double& InTarget ) : Target ( InTarget ), StartTime ( FPlatformTime::Seconds ( ) )
+		{
+		}
+
+		~FScope ( )
+		{
+			Target += FPlatformTime::Seconds ( ) - StartTime;
+		}
+
+	private:
+
+		double&      Target;
+		const double StartTime;
+	};
 };
 
 USTRUCT ( )
@@ -117,6 +514,10 @@ public:
 	uint16 DataID = 0;
 
 	FDynamicMesh3      MeshData        = FDynamicMesh3 ( UE::Geometry::EMeshComponents::FaceGroups );
+
+	/* Only fill by ELPPMarchingMesherType::VertexStream and ELPPMarchingMesherType::SurfaceNets */
+	FLPPDynamicMeshStreamData StreamData = FLPPDynamicMeshStreamData ( );
+
 	Nanite::FResources NaniteResources = Nanite::FResources ( );
 
 	FMeshCardsBuildData LumenCardData = FMeshCardsBuildData ( );
@@ -128,21 +529,78 @@ public:
 
 	bool bIsNaniteValid = false;
 
+	/* Set by worker when the snapshot is complete empty or full */
+	bool bIsSkipOnEmpty = false;
+	bool bIsSkipOnFull  = false;
+
+	/* Set by worker when a partial job leave the solid unchanged, Lumen card and collision of the current mesh is keep */
+	bool bIsSolidUnchanged = false;
+
+	FLPPMarchingStageTiming StageTiming = FLPPMarchingStageTiming ( );
+
+public:
+
+	/* Worker scratch, keep its capacity while the thread data sit in the component pool */
+	FLPPMarchingSolidCache      SolidCache     = FLPPMarchingSolidCache ( );
+
+	TArray < FLPPMarchingSolidCache > LayerSolidCacheList = TArray < FLPPMarchingSolidCache > ( );
+
+	TArray < uint8 >            MarchingIDList = TArray < uint8 > ( );
+	TMap < FIntVector , int32 > WeldVertexMap  = TMap < FIntVector , int32 > ( );
+
+	/* Surface nets vertex index per marching cell */
+	TArray < int32 > SurfaceVertexList = TArray < int32 > ( );
+
+	/* Greedy face layer per slice cell */
+	TArray < int32 > GreedyFaceMask = TArray < int32 > ( );
+
+	/* Tile border flag per merged stream vertex */
+	TBitArray < > StreamBorderList = TBitArray < > ( );
+
+	/* Solid cell not yet claim by a collision box */
+	FLPPMarchingSolidCache CollisionClaimCache = FLPPMarchingSolidCache ( );
+
+	/* Reduced solid use by render mesh when LODIndex is above zero */
+	FLPPMarchingSolidCache            LODSolidCache          = FLPPMarchingSolidCache ( );
+	TArray < FLPPMarchingSolidCache > LODLayerSolidCacheList = TArray < FLPPMarchingSolidCache > ( );
+
 public:
 
+	/* Output is move into render data on commit, only scratch capacity survive */
+	void ResetForReuse ( )
+	{
+		MeshData.Clear ( );
+		StreamData.Reset ( );
+
+		NaniteResources = Nanite::FResources ( );
+		LumenCardData   = FMeshCardsBuildData ( );
+
+		CollisionBoxElems.Reset ( );
+
+		bIsNaniteValid = false;
+		bIsSkipOnEmpty    = false;
+		bIsSkipOnFull     = false;
+		bIsSolidUnchanged = false;
+
+		StageTiming = FLPPMarchingStageTiming ( );
+	}
+
 	uint32 GetByteCount ( ) const // Need Rework
 	{
-		return sizeof ( FLFPMarchingThreadData ) + MeshData.GetByteCount ( ) + ( sizeof ( FKBoxElem ) * CollisionBoxElems.Num ( ) );
+		return sizeof ( FLFPMarchingThreadData ) + MeshData.GetByteCount ( ) + StreamData.GetByteCount ( ) + ( sizeof ( FKBoxElem ) * CollisionBoxElems.Num ( ) );
 	}
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam ( FLFPOnMarchingMeshGenerateEvent , USceneComponent* , Component );
 
 UCLASS ( ClassGroup=(Custom) , meta=(BlueprintSpawnableComponent) )
-class LOHPROCEDURALPLUGINMARCHING_API ULPPMarchingMeshComponent : public ULPPDynamicMesh
+class LOHPROCEDURALPLUGINMARCHING_API ULPPMarchingMeshComponent : public ULPPDynamicMesh , public ILPPChunkActorInterface
 {
 	GENERATED_BODY ( )
 
+	/* Benchmark run the task function directly */
+	friend class ULPPMarchingFunctionLibrary;
+
 public:
 
 	// Sets default values for this component's properties
@@ -155,6 +613,8 @@ protected:
 
 	virtual void EndPlay ( const EEndPlayReason::Type EndPlayReason ) override;
 
+	virtual void PostLoad ( ) override;
+
 public:
 
 	// Called every frame
@@ -188,25 +648,57 @@ protected:
 	UPROPERTY ( EditDefaultsOnly , Category="Setting|Render" )
 	TObjectPtr < ULPPMarchingData > RenderSetting = nullptr;
 
+	/* Only VertexStream split the chunk across worker thread and support UpdateRenderPartial, use it for large chunk near the player */
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|Render" )
+	ELPPMarchingMesherType MesherType = ELPPMarchingMesherType::DynamicMesh;
+
 	UPROPERTY ( EditDefaultsOnly , Category="Setting|Render" )
 	FGameplayTag HandleTag = FGameplayTag::EmptyTag;
 
+	/* Replace HandleTag and RenderSetting when not empty, every layer must share the same marching size */
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|Render" )
+	TArray < FLPPMarchingLayerSetting > LayerList;
+
 	UPROPERTY ( EditDefaultsOnly , Category="Setting|Render" )
 	float EdgeMergeDistance = 2.0f;
 
+	/* Tile normal meeting on a welded tile border within this angle is average so tile join shade smooth */
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|Render" , meta = ( ClampMin = 0 , ClampMax = 180 ) )
+	float SeamNormalAngle = 45.0f;
+
 	UPROPERTY ( EditDefaultsOnly , Category="Setting|Render" )
 	float BoundExpand = 25.0f;
 
-	UPROPERTY ( EditAnywhere , Category = "Setting|Render" )
-	float MeshUpdateBoundRadius = 6400.0f;
+	/* Old per component rebuild delay, keep so saved value still load, rebuild order now come from SetupRebuildQueue */
+	UPROPERTY ( meta = ( DeprecatedProperty , DeprecationMessage = "Rebuild is order by the shared queue, use SetupRebuildQueue on ULPPProceduralWorldTaskSubsystem" ) )
+	float MeshUpdateBoundRadius_DEPRECATED = 6400.0f;
+
+	UPROPERTY ( meta = ( DeprecatedProperty , DeprecationMessage = "Rebuild is order by the shared queue, use SetupRebuildQueue on ULPPProceduralWorldTaskSubsystem" ) )
+	float FastUpdateRadius_DEPRECATED = 3200.0f;
+
+	/* Cell size of cached sub block use by UpdateRenderPartial, vertex stream only */
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|Render" , meta = ( ClampMin = 1 ) )
+	int32 SubBlockSize = 8;
+
 
-	UPROPERTY ( EditAnywhere , Category = "Setting|Render" )
-	float FastUpdateRadius = 3200.0f;
+	/* Render mesh use 2 ^ LODIndex cell per LOD cell, drop to lower LOD when DataSize can't be divide */
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|LOD" , meta = ( ClampMin = 0 , ClampMax = 2 ) )
+	int32 LODIndex = 0;
+
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|LOD" )
+	ELPPMarchingLODReduction LODReduction = ELPPMarchingLODReduction::AnySolid;
+
+	/* Hang skirt from open edge on the chunk face so neighbour chunk on other LOD show no crack */
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|LOD" )
+	bool bGenerateLODSkirt = true;
 
 
 	UPROPERTY ( EditDefaultsOnly , Category="Setting|Simplify" )
 	bool bSimplifyRenderData = false;
 
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|Simplify" )
+	ELPPMarchingSimplifyMethod SimplifyMethod = ELPPMarchingSimplifyMethod::PlanarMerge;
+
 	UPROPERTY ( EditDefaultsOnly , Category="Setting|Simplify" )
 	float SimplifyAngle = 2.0f;
 
@@ -218,9 +710,18 @@ protected:
 	FTransform UVBoxTransform = FTransform ( );
 
 
+	/* Card over this count is merge with the nearest card on the same direction, zero is no limit ( Default, same card as before the limit is add ) */
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|Lumen" , meta = ( ClampMin = 0 ) )
+	int32 MaxLumenCardCount = 0;
+
+
 	UPROPERTY ( EditDefaultsOnly , Category="Setting|Collision" )
 	bool bGenerateSimpleBoxCollisionData = false;
 
+	/* Box over this count is merge, touching box sharing a matching face first, after that the bounding box of a pair add collision over empty cell and can seal a thin tunnel, zero is no limit */
+	UPROPERTY ( EditDefaultsOnly , Category="Setting|Collision" , meta = ( ClampMin = 0 ) )
+	int32 MaxCollisionBoxCount = 0;
+
 
 	UPROPERTY ( EditDefaultsOnly , Category="Setting|DistanceField" )
 	bool bGenerateDistanceField = false;
@@ -289,8 +790,12 @@ protected:
 	UFUNCTION ( )
 	uint8 GetMarchingID ( const FIntVector& Offset ) const;
 
-	UFUNCTION ( )
-	float GetPlayerDistance ( ) const;
+	/* LayerList or a single layer made from HandleTag and RenderSetting */
+	void GetLayerSettingList ( TArray < FLPPMarchingLayerSetting >& OutLayerList ) const;
+
+	ULPPMarchingData* GetPrimaryRenderSetting ( ) const;
+
+	bool IsHandleTag ( const FGameplayTag& CellTag ) const;
 
 public:
 
@@ -308,14 +813,40 @@ public:
 	UFUNCTION ( BlueprintCallable , Category = "LFPVoxelRender" )
 	void UpdateRender ( );
 
+	/* Only remesh sub block touch by the changed data index, fall back to UpdateRender when nothing is cached or the list is empty */
+	UFUNCTION ( BlueprintCallable , Category = "LFPVoxelRender" )
+	void UpdateRenderPartial ( const TArray < int32 >& DataIndexList );
+
+	/* Send by chunk manager when component notify is on, forward to UpdateRenderPartial */
+	virtual void OnRequestChunkUpdate_Implementation ( const TArray < int32 >& DataIndexList , const bool bIsMetaUpdate ) override;
+
+	/* Send by chunk manager when component notify is on, forward to SetLODIndex */
+	virtual void OnLODChanged_Implementation ( const int32 NewLODIndex ) override;
+
 	UFUNCTION ( BlueprintPure , Category = "LFPVoxelRender" )
 	bool IsRendering ( ) const;
 
+	/* LOD selection hook, rebuild only when the LOD change */
+	UFUNCTION ( BlueprintCallable , Category = "LFPVoxelRender" )
+	void SetLODIndex ( const int32 NewLODIndex );
+
+	UFUNCTION ( BlueprintPure , Category = "LFPVoxelRender" )
+	int32 GetLODIndex ( ) const;
+
 private:
 
-	UFUNCTION ( )
+	/* Run by the rebuild queue in ULPPProceduralWorldTaskSubsystem */
 	void UpdateRender_Internal ( );
 
+	/* Queue UpdateRender_Internal, pending dirty block and full rebuild flag is keep */
+	void QueueRebuild ( );
+
+	/* Copy cell tag only, solid check is done by the worker */
+	void CaptureCellSnapshot ( FLPPMarchingCellSnapshot& OutSnapshot ) const;
+
+	/* Recapture the dirty data cell and the cell around it, use by partial rebuild */
+	void PatchCellSnapshot ( FLPPMarchingCellSnapshot& Snapshot , const TSet < int32 >& DirtyDataIndexSet ) const;
+
 protected:
 
 	// Add Mesh Fill
@@ -325,11 +856,6 @@ public:
 
 	virtual void NotifyMeshUpdated ( ) override;
 
-private:
-
-	UPROPERTY ( )
-	FTimerHandle UpdateRenderTimer = FTimerHandle ( );
-
 private:
 
 	TArray < FLumenCardBuildData > CurrentLumenCardData = TArray < FLumenCardBuildData > ( );
@@ -341,7 +867,29 @@ private:
 
 	TUniquePtr < FLFPMarchingThreadData > NewThreadData = nullptr;
 
-	static void ComputeNewMarchingMesh_TaskFunction ( TUniquePtr < FLFPMarchingThreadData >& ThreadData , FProgressCancel& Progress , const TBitArray < >& SolidList , const FLFPMarchingPassData& PassData );
+	FCriticalSection ThreadDataPoolSection;
+
+	/* Thread data return here after commit so the next rebuild reuse its buffer */
+	TArray < TUniquePtr < FLFPMarchingThreadData > > ThreadDataPool;
+
+	TUniquePtr < FLFPMarchingThreadData > AcquireThreadData ( );
+
+	void ReleaseThreadData ( TUniquePtr < FLFPMarchingThreadData >&& ThreadData );
+
+	TSharedPtr < FLPPMarchingStreamBlockCache , ESPMode::ThreadSafe > StreamBlockCache = nullptr;
+
+	TSet < int32 > PendingDirtyBlockSet = TSet < int32 > ( );
+	TSet < int32 > PendingDirtyDataSet  = TSet < int32 > ( );
+
+	bool bIsFullRebuildPending = true;
+
+	/* Snapshot of the last vertex stream job, patch by the next partial rebuild */
+	FLPPMarchingCellSnapshot CachedCellSnapshot = FLPPMarchingCellSnapshot ( );
+
+	/* Solid of the committed mesh, a job that skip Lumen card and collision must match it */
+	FLPPMarchingSolidCache CommittedSolidCache = FLPPMarchingSolidCache ( );
+
+	static void ComputeNewMarchingMesh_TaskFunction ( TUniquePtr < FLFPMarchingThreadData >& ThreadData , FProgressCancel& Progress , const FLPPMarchingCellSnapshot& CellSnapshot , const FLFPMarchingPassData& PassData );
 
 	void ComputeNewMarchingMesh_Completed ( TUniquePtr < FLFPMarchingThreadData >& ThreadData , TQueue < TFunction < void  ( ) > , EQueueMode::Mpsc >& GameThreadJob );
 
@@ -67,6 +67,29 @@ public:
 	}
 };
 
+/* Tile mesh already rotated for one marching ID, mesher only need to translate it */
+struct FLPPMarchingBakedTile
+{
+	TArray < FVector3f > PositionList = TArray < FVector3f > ( );
+	TArray < FVector3f > NormalList   = TArray < FVector3f > ( );
+	TArray < FVector2f > UVList       = TArray < FVector2f > ( );
+
+	/* Normal on the tile bound face, mesher average these with the neighbour tile on welded seam */
+	TBitArray < > BorderNormalList = TBitArray < > ( );
+
+	/* Index into PositionList , NormalList and UVList per triangle */
+	TArray < FIntVector3 > TriangleList       = TArray < FIntVector3 > ( );
+	TArray < FIntVector3 > TriangleNormalList = TArray < FIntVector3 > ( );
+	TArray < FIntVector3 > TriangleUVList     = TArray < FIntVector3 > ( );
+
+	TArray < int32 > MaterialIDList = TArray < int32 > ( );
+	TArray < int32 > GroupIDList    = TArray < int32 > ( );
+
+public:
+
+	FORCEINLINE bool IsEmpty ( ) const { return TriangleList.IsEmpty ( ); }
+};
+
 /**
  * 
  */
@@ -91,6 +114,9 @@ protected:
 	/* Mesh Data For Component */
 	TArray < FDynamicMesh3 > DynamicMeshList = TArray < FDynamicMesh3 > ( );
 
+	/* Rotated mesh for every marching ID, index is the marching ID */
+	TArray < FLPPMarchingBakedTile > BakedTileList = TArray < FLPPMarchingBakedTile > ( );
+
 	UPROPERTY ( VisibleAnywhere , Category = Default )
 	TArray < TSoftObjectPtr < UStaticMesh > > StaticMeshList = TArray < TSoftObjectPtr < UStaticMesh > > ( );
 
@@ -136,6 +162,12 @@ public:
 
 	FLFPMarchingMeshMappingDataV2 GetMappingData ( const uint8 MarchingID ) const;
 
+	/* Return nullptr if the marching ID has no mesh */
+	FORCEINLINE const FLPPMarchingBakedTile* GetBakedTile ( const uint8 MarchingID ) const
+	{
+		return BakedTileList.IsValidIndex ( MarchingID ) && BakedTileList [ MarchingID ].IsEmpty ( ) == false ? &BakedTileList [ MarchingID ] : nullptr;
+	}
+
 #if WITH_EDITOR
 
 protected:
@@ -155,4 +187,16 @@ protected:
 
 	UFUNCTION ( )
 	void GenerateDynamicMeshList ( );
+
+	/* Bake MappingDataList and DynamicMeshList into BakedTileList */
+	void GenerateBakedTileList ( );
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+public:
+
+	/* Use generated tile instead of static mesh asset, so automation test don't need any content */
+	void SetupTestTileList ( const FIntVector& NewMarchingSize , TArray < FDynamicMesh3 >&& NewDynamicMeshList , const TMap < uint8 , FLFPMarchingMeshMappingDataV2 >& NewMappingDataList );
+
+#endif
 };
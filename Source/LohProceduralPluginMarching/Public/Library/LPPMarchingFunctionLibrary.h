@@ -8,10 +8,24 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "Components/LPPMarchingMeshComponent.h"
 #include "LPPMarchingFunctionLibrary.generated.h"
 
+class ULPPMarchingData;
 class ULFPMarchingDataComponent;
 class ULFPChunkedTagDataComponent;
+
+/* Output of one marching run, use by benchmark */
+struct FLPPMarchingMeshHash
+{
+	int32 VertexCount   = 0;
+	int32 TriangleCount = 0;
+
+	uint32 MeshHash      = 0;
+	uint32 CollisionHash = 0;
+	uint32 LumenHash     = 0;
+};
+
 /**
  * 
  */
@@ -42,4 +56,21 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "LFPMarchingLibrary|Function")
 	static uint8 CalculateDualGridMarchingID( const uint8 FullMarchingID , const int32 CalculateIndex );
+
+	/*
+	 * Run the marching task function headless on a seeded random solid set
+	 * Return JSON with output hash ( mesh , box collision , lumen card ) and average stage time in ms
+	 * FillRatio <= 0 generate a structured terrain like height field instead of random noise
+	 */
+	UFUNCTION(BlueprintCallable, Category = "LFPMarchingLibrary|Benchmark")
+	static FString BenchmarkMarchingMesh( ULPPMarchingData* RenderSetting , const FGameplayTag HandleTag , const FIntVector DataSize , const int32 Seed , const float FillRatio , const ELPPMarchingMesherType MesherType , const int32 IterationCount = 8 );
+
+	/* Run the marching task function on the calling thread, use by benchmark and automation test */
+	static void ComputeMarchingMesh( TUniquePtr < FLFPMarchingThreadData >& ThreadData , const FLPPMarchingCellSnapshot& CellSnapshot , const FLFPMarchingPassData& PassData );
+
+	/* Seeded solid set use by BenchmarkMarchingMesh, FillRatio <= 0 is the height field */
+	static void CreateBenchmarkSnapshot( FLPPMarchingCellSnapshot& OutSnapshot , const FGameplayTag HandleTag , const FIntVector DataSize , const int32 Seed , const float FillRatio );
+
+	/* CRC of the mesh , box collision and lumen card output, vertex stream is hash before any dynamic mesh conversion */
+	static FLPPMarchingMeshHash GetMarchingMeshHash( const FLFPMarchingThreadData& ThreadData );
 };